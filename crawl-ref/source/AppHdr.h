@@ -121,6 +121,12 @@ static inline double pow(int x, double y) { return std::pow((double)x, y); }
 
     #define USE_UNIX_SIGNALS
 
+    // Allow games to be forked from a process that has already loaded the
+    // game data (-fork-server and -fork-client).
+    #if !defined(USE_TILE_LOCAL) && !defined(__ANDROID__)
+    #define USE_FORK_SERVER
+    #endif
+
     #define FILE_SEPARATOR '/'
 
     // More sophisticated character handling
@@ -319,6 +325,13 @@ static inline double pow(int x, double y) { return std::pow((double)x, y); }
 // on by default (and has been for ~10 years)
 #define DEBUG_ITEM_SCAN
 
+// Per-subsystem turn timers, for -profile-turns and the wizard mode turn
+// profile display. They are cheap enough to leave on in production; build
+// with -DNO_TURN_PROFILER to compile them out entirely.
+#ifndef NO_TURN_PROFILER
+    #define TURN_PROFILER
+#endif
+
 #ifdef _DEBUG       // this is how MSVC signals a debug build
     #ifndef DEBUG
     #define DEBUG
@@ -1184,6 +1184,17 @@ static dungeon_feature_type _veto_dangerous_terrain(dungeon_feature_type feat)
     return feat;
 }
 
+// Would changing between these features change what can be seen through the
+// cell, for any of the kinds of LOS?
+static bool _opacity_changes(dungeon_feature_type from,
+                             dungeon_feature_type to)
+{
+    return feat_is_opaque(from) != feat_is_opaque(to)
+           || feat_is_solid(from) != feat_is_solid(to)
+           || feat_is_wall(from) != feat_is_wall(to)
+           || feat_is_closed_door(from) != feat_is_closed_door(to);
+}
+
 static void _update_abyss_terrain(const coord_def &p,
     const map_bitmask &abyss_genlevel_mask, bool morph)
 {
@@ -1242,6 +1253,10 @@ static void _update_abyss_terrain(const coord_def &p,
     if (feat != currfeat)
     {
         grd(rp) = feat;
+        // Newly generated areas get a full LOS reset from their callers,
+        // but morphing touches only a few cells, so just redo LOS near them.
+        if (morph && _opacity_changes(currfeat, feat))
+            los_terrain_changed(rp);
         if (feat == DNGN_FLOOR && in_los_bounds_g(rp))
         {
             cloud_type cloud = _cloud_from_feat(currfeat);
@@ -1666,7 +1681,6 @@ void abyss_morph()
     _abyss_apply_terrain(abyss_genlevel_mask, true);
     _place_displaced_monsters();
     _push_items();
-    los_changed();
 }
 
 // Force the player one level deeper in the abyss during an abyss teleport with
@@ -5,6 +5,27 @@
 #include "env.h"
 #include "losglobal.h"
 
+// The next used monster slot after i whose monster stands within radius of
+// center, or MAX_MONSTERS if there is none. A negative radius matches
+// everywhere. Checked against the compact monster index, so that monsters
+// which are out of range are skipped without touching the monster objects
+// themselves.
+static int _next_in_range(int i, const coord_def &center, int radius)
+{
+    if (radius < 0)
+        return env.mons_index.next(i);
+
+    while ((i = env.mons_index.next_near(i, center, radius)) < MAX_MONSTERS)
+        if ((env.mons_index.pos(i) - center).rdist() <= radius)
+            break;
+    return i;
+}
+
+static int _los_range(los_type los)
+{
+    return los == LOS_NONE ? -1 : LOS_RADIUS;
+}
+
 actor_near_iterator::actor_near_iterator(coord_def c, los_type los)
     : center(c), _los(los), viewer(nullptr), i(-1)
 {
@@ -63,27 +84,24 @@ bool actor_near_iterator::valid(const actor* a) const
 
 void actor_near_iterator::advance()
 {
-    do
-         if (++i >= MAX_MONSTERS)
-             return;
-    while (!valid(**this));
+    while ((i = _next_in_range(i, center, _los_range(_los))) < MAX_MONSTERS)
+        if (valid(&menv[i]))
+            return;
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 monster_near_iterator::monster_near_iterator(coord_def c, los_type los)
-    : center(c), _los(los), viewer(nullptr), i(0)
+    : center(c), _los(los), viewer(nullptr), i(-1)
 {
-    if (!valid(&menv[0]))
-        advance();
+    advance();
     begin_point = i;
 }
 
 monster_near_iterator::monster_near_iterator(const actor *a, los_type los)
-    : center(a->pos()), _los(los), viewer(a), i(0)
+    : center(a->pos()), _los(los), viewer(a), i(-1)
 {
-    if (!valid(&menv[0]))
-        advance();
+    advance();
     begin_point = i;
 }
 
@@ -153,19 +171,27 @@ bool monster_near_iterator::valid(const monster* a) const
 
 void monster_near_iterator::advance()
 {
-    do
-         if (++i >= MAX_MONSTERS)
-             return;
-    while (!valid(**this));
+    while ((i = _next_in_range(i, center, _los_range(_los))) < MAX_MONSTERS)
+        if (valid(&menv[i]))
+            return;
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 monster_iterator::monster_iterator()
-    : i(0)
+    : center(), radius(-1), i(-1)
 {
-    while (i < MAX_MONSTERS && !menv[i].alive())
-        i++;
+    advance();
+}
+
+monster_iterator::monster_iterator(const coord_def &c, int r)
+    : center(c), radius(r), i(-1)
+{
+    // Nothing can be within a negative distance.
+    if (radius < 0)
+        i = MAX_MONSTERS;
+    else
+        advance();
 }
 
 monster_iterator::operator bool() const
@@ -188,9 +214,7 @@ monster* monster_iterator::operator->() const
 
 monster_iterator& monster_iterator::operator++()
 {
-    while (++i < MAX_MONSTERS)
-        if (menv[i].alive())
-            break;
+    advance();
     return *this;
 }
 
@@ -203,8 +227,7 @@ monster_iterator monster_iterator::operator++(int)
 
 void monster_iterator::advance()
 {
-    do
-         if (++i >= MAX_MONSTERS)
-             return;
-    while (!(*this)->alive());
+    while ((i = _next_in_range(i, center, radius)) < MAX_MONSTERS)
+        if (menv[i].alive())
+            return;
 }
@@ -60,6 +60,8 @@ class monster_iterator
 {
 public:
     monster_iterator();
+    // Only monsters no further than radius (in grid_distance) from c.
+    monster_iterator(const coord_def &c, int radius);
 
     operator bool() const;
     monster* operator*() const;
@@ -68,6 +70,8 @@ public:
     monster_iterator operator++(int);
 
 protected:
+    coord_def center;
+    int radius;
     int i;
     void advance();
 };
@@ -785,6 +785,18 @@ namespace arena
         is_respawning = false;
     }
 
+    // The player sees the whole arena, so world_reacts() should have marked
+    // every monster that was visible at the start of the turn as seen.
+    static void check_seen(const vector<mid_t> &in_view)
+    {
+        for (mid_t mid : in_view)
+        {
+            const monster *mons = monster_by_mid(mid, true);
+            if (mons && mons->alive() && !(mons->flags & MF_POLYMORPHED))
+                ASSERT(mons->flags & MF_SEEN);
+        }
+    }
+
     static void do_fight()
     {
         viewwindow();
@@ -805,7 +817,12 @@ namespace arena
                 // Make sure we don't starve.
                 you.hunger = HUNGER_MAXIMUM;
                 //report_foes();
+                vector<mid_t> in_view;
+                for (monster_iterator mons; mons; ++mons)
+                    if (mons->visible_to(&you))
+                        in_view.push_back(mons->mid);
                 world_reacts();
+                check_seen(in_view);
                 do_miscasts();
                 do_respawn(faction_a);
                 do_respawn(faction_b);
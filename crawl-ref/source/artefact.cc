@@ -1035,18 +1035,29 @@ void artefact_properties(const item_def &item,
     artefact_properties(item, proprt, known);
 }
 
+// The player's resistances, stealth and so on ask every worn artefact for
+// a property each time they're checked, so look up just the one property
+// rather than unpacking them all with artefact_properties().
 int artefact_property(const item_def &item, artefact_prop_type prop,
                       bool &_known)
 {
-    artefact_properties_t  proprt;
-    artefact_known_props_t known;
-    proprt.init(0);
-    known.init(0);
+    ASSERT(is_artefact(item));
+    _known = false;
+    if (!item.props.exists(KNOWN_PROPS_KEY))
+        return 0;
 
-    artefact_properties(item, proprt, known);
+    _known = item_ident(item, ISFLAG_KNOW_PROPERTIES)
+             || item.props[KNOWN_PROPS_KEY].get_vector()[prop].get_bool();
+
+    if (item.props.exists(ARTEFACT_PROPS_KEY))
+        return item.props[ARTEFACT_PROPS_KEY].get_vector()[prop].get_short();
 
-    _known = known[prop];
+    if (is_unrandom_artefact(item))
+        return static_cast<short>(_seekunrandart(item)->prpty[prop]);
 
+    artefact_properties_t proprt;
+    proprt.init(0);
+    _get_randart_properties(item, proprt);
     return proprt[prop];
 }
 
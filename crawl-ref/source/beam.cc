@@ -1702,11 +1702,8 @@ spret mass_enchantment(enchant_type wh_enchant, int pow, bool fail)
 
     pow = min(pow, 200);
 
-    for (monster_iterator mi; mi; ++mi)
+    for (monster_near_iterator mi(you.pos(), LOS_NO_TRANS); mi; ++mi)
     {
-        if (!you.see_cell_no_trans(mi->pos()))
-            continue;
-
         if (mi->has_ench(wh_enchant))
             continue;
 
@@ -37,6 +37,7 @@
 #include "stringutil.h"
 #include "terrain.h"
 #include "tiledef-main.h"
+#include "turn-profile.h"
 #include "unwind.h"
 
 cloud_struct* cloud_at(coord_def pos)
@@ -563,6 +564,8 @@ static void _handle_spectral_cloud(const cloud_struct& cloud)
 
 void manage_clouds()
 {
+    PROFILE_SECTION(PROF_CLOUDS);
+
     // We can't iterate over env.cloud directly because _dissipate_cloud
     // will remove this cloud and invalidate our iterator.
     vector<cloud_struct *> cloud_ptrs;
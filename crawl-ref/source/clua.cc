@@ -3,6 +3,7 @@
 #include "clua.h"
 
 #include <algorithm>
+#include <cstring>
 
 #include "cluautil.h"
 #include "dlua.h"
@@ -43,6 +44,42 @@ static int  _clua_panic(lua_State *);
 static void _clua_throttle_hook(lua_State *, lua_Debug *);
 #ifndef NO_CUSTOM_ALLOCATOR
 static void *_clua_allocator(void *ud, void *ptr, size_t osize, size_t nsize);
+
+// Scripts in the managed VM run on every turn and message, and most of what
+// they allocate is small strings and tables that die young. This keeps
+// freed blocks on free lists by size class rather than going through
+// malloc each time; bigger blocks go straight to the system. Slabs are only
+// given back when the CLua is destroyed, which the memory cap keeps bounded.
+class lua_slab_pool
+{
+public:
+    ~lua_slab_pool();
+
+    void *allocate(size_t size);
+    void release(void *ptr, size_t size);
+    void *reallocate(void *ptr, size_t osize, size_t nsize);
+
+private:
+    static const size_t GRANULE = 16;
+    static const size_t MAX_SIZE = 512;
+    static const size_t NUM_CLASSES = MAX_SIZE / GRANULE;
+    static const size_t SLAB_SIZE = 64 * 1024;
+
+    struct free_block
+    {
+        free_block *next;
+    };
+
+    static size_t size_class(size_t size)
+    {
+        return (size - 1) / GRANULE;
+    }
+
+    free_block *free_blocks[NUM_CLASSES] = { };
+    char *slab_next[NUM_CLASSES] = { };
+    size_t slab_left[NUM_CLASSES] = { };
+    vector<char *> slabs;
+};
 #endif
 static int  _clua_guarded_pcall(lua_State *);
 static int  _clua_require(lua_State *);
@@ -56,7 +93,7 @@ CLua::CLua(bool managed)
       throttle_sleep_ms(0), throttle_sleep_start(2),
       throttle_sleep_end(800), n_throttle_sleeps(0), mixed_call_depth(0),
       lua_call_depth(0), max_mixed_call_depth(8),
-      max_lua_call_depth(100), memory_used(0),
+      max_lua_call_depth(100), memory_used(0), pool(nullptr),
       _state(nullptr), sourced_files(), uniqindex(0)
 {
 }
@@ -72,6 +109,9 @@ CLua::~CLua()
     shutting_down = true;
     if (_state)
         lua_close(_state);
+#ifndef NO_CUSTOM_ALLOCATOR
+    delete pool;
+#endif
 }
 
 lua_State *CLua::state()
@@ -744,6 +784,8 @@ void CLua::init_lua()
     _state = luaL_newstate();
 #else
     // Throttle memory usage in managed (clua) VMs
+    if (managed_vm && !pool)
+        pool = new lua_slab_pool;
     _state = managed_vm? lua_newstate(_clua_allocator, this) : luaL_newstate();
 #endif
     if (!_state)
@@ -1102,24 +1144,111 @@ static int _clua_panic(lua_State *ls)
 }
 
 #ifndef NO_CUSTOM_ALLOCATOR
+void *lua_slab_pool::allocate(size_t size)
+{
+    if (size > MAX_SIZE)
+        return malloc(size);
+
+    const size_t sc = size_class(size);
+    if (free_block *block = free_blocks[sc])
+    {
+        free_blocks[sc] = block->next;
+        return block;
+    }
+
+    if (!slab_left[sc])
+    {
+        char *slab = static_cast<char *>(malloc(SLAB_SIZE));
+        if (!slab)
+            return nullptr;
+        slabs.push_back(slab);
+        slab_next[sc] = slab;
+        slab_left[sc] = SLAB_SIZE / ((sc + 1) * GRANULE);
+    }
+    --slab_left[sc];
+    void *ptr = slab_next[sc];
+    slab_next[sc] += (sc + 1) * GRANULE;
+    return ptr;
+}
+
+void lua_slab_pool::release(void *ptr, size_t size)
+{
+    if (size > MAX_SIZE)
+    {
+        free(ptr);
+        return;
+    }
+
+    free_block *block = static_cast<free_block *>(ptr);
+    const size_t sc = size_class(size);
+    block->next = free_blocks[sc];
+    free_blocks[sc] = block;
+}
+
+void *lua_slab_pool::reallocate(void *ptr, size_t osize, size_t nsize)
+{
+    if (!ptr)
+        return allocate(nsize);
+
+    // Neither is the pool's business, so realloc can work in place.
+    if (osize > MAX_SIZE && nsize > MAX_SIZE)
+        return realloc(ptr, nsize);
+
+    if (osize <= MAX_SIZE && nsize <= MAX_SIZE
+        && size_class(osize) == size_class(nsize))
+    {
+        return ptr;
+    }
+
+    void *nptr = allocate(nsize);
+    if (!nptr)
+    {
+        // Lua assumes shrinking never fails, and the old block is big
+        // enough. It will come back to release() with the smaller size,
+        // which at worst wastes the difference.
+        return nsize < osize ? ptr : nullptr;
+    }
+    memcpy(nptr, ptr, min(osize, nsize));
+    release(ptr, osize);
+    return nptr;
+}
+
+lua_slab_pool::~lua_slab_pool()
+{
+    for (char *slab : slabs)
+        free(slab);
+}
+
 static void *_clua_allocator(void *ud, void *ptr, size_t osize, size_t nsize)
 {
     CLua *cl = static_cast<CLua *>(ud);
-    cl->memory_used += nsize - osize;
 
-    if (nsize > osize && cl->memory_used >= CLUA_MAX_MEMORY_USE * 1024
-        && cl->mixed_call_depth)
+    if (!ptr)
+        osize = 0;
+
+    if (!nsize)
     {
+        if (ptr)
+        {
+            cl->memory_used -= osize;
+            cl->pool->release(ptr, osize);
+        }
         return nullptr;
     }
 
-    if (!nsize)
+    if (nsize > osize
+        && cl->memory_used + (long) (nsize - osize)
+           >= CLUA_MAX_MEMORY_USE * 1024
+        && cl->mixed_call_depth)
     {
-        free(ptr);
         return nullptr;
     }
-    else
-        return realloc(ptr, nsize);
+
+    void *nptr = cl->pool->reallocate(ptr, osize, nsize);
+    // Only count what Lua actually got; on failure it keeps the old block.
+    if (nptr)
+        cl->memory_used += (long) nsize - (long) osize;
+    return nptr;
 }
 #endif
 
@@ -15,6 +15,7 @@ extern "C" {
 #include "maybe-bool.h"
 
 class CLua;
+class lua_slab_pool;
 
 class lua_stack_cleaner
 {
@@ -161,6 +162,7 @@ public:
     int max_lua_call_depth;
 
     long memory_used;
+    lua_slab_pool *pool;
 
     static const int MAX_THROTTLE_SLEEPS = 100;
 
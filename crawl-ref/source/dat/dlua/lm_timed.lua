@@ -51,6 +51,7 @@ function TimedMarker:activate(marker, verbose)
   dgn.register_listener(dgn.dgn_event_type('entered_level'), marker)
   dgn.register_listener(dgn.dgn_event_type('player_los'), marker, marker:pos())
   dgn.register_listener(dgn.dgn_event_type('turn'), marker)
+  self:sleep(marker)
 end
 
 function TimedMarker:property(marker, pname)
@@ -70,6 +71,18 @@ function TimedMarker:start_short(marker)
   end
 end
 
+-- Ask not to be told about turns passing until the timer runs out or the
+-- messager next has something to say. Any other event wakes us early.
+function TimedMarker:sleep(marker)
+  local wait = self.dur
+  if self.msg.quiet_ticks then
+    wait = math.min(wait, self.msg:quiet_ticks(self))
+  end
+  if wait > 1 then
+    dgn.schedule_wakeup(marker, wait)
+  end
+end
+
 function TimedMarker:disappear(marker, x, y)
   dgn.remove_listener(marker)
   self.super.disappear(self, marker, x, y)
@@ -119,6 +132,7 @@ function TimedMarker:event(marker, ev)
       return true
     end
   end
+  self:sleep(marker)
 end
 
 function TimedMarker:describe(marker)
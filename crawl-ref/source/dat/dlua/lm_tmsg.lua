@@ -181,6 +181,18 @@ function TimedMessaging:event(luamark, cmarker, event)
   end
 end
 
+-- How long the timer can run before event() would want to speak.
+function TimedMessaging:quiet_ticks(luamark)
+  if not self._have_entered_level then
+    return luamark.dur
+  end
+  local wait = luamark.dur - self.check + 1
+  if self.check > -150 then
+    wait = math.min(wait, luamark.dur - 100)
+  end
+  return wait
+end
+
 function TimedMessaging:write(th)
   lmark.marshall_table(th, self)
 end
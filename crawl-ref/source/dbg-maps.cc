@@ -19,6 +19,7 @@
 #include "message.h"
 #include "ng-init.h"
 #include "player.h"
+#include "random.h"
 #include "shopping.h"
 #include "state.h"
 #include "stringutil.h"
@@ -46,6 +47,50 @@ static int build_attempts = 0, level_vetoes = 0;
 // Map from message to counts.
 static map<string, int> veto_messages;
 
+// -bench-levelgen timings.
+struct levelgen_timing
+{
+    int64_t usecs = 0;
+    int64_t max_usecs = 0;
+    int count = 0;
+
+    void add(int64_t t)
+    {
+        usecs += t;
+        max_usecs = max(max_usecs, t);
+        ++count;
+    }
+};
+
+static const char *levelgen_stage_names[] =
+{
+    "layout", "vaults", "connectivity", "monsters", "items", "validation",
+    "whole attempt",
+};
+COMPILE_CHECK(ARRAYSZ(levelgen_stage_names) == NUM_LEVELGEN_STAGES);
+
+static levelgen_timing stage_timings[NUM_LEVELGEN_STAGES];
+static map<string, levelgen_timing> vault_timings;
+static map<level_id, levelgen_timing> level_timings;
+
+static int64_t _usecs_since(chrono::steady_clock::time_point start)
+{
+    return chrono::duration_cast<chrono::microseconds>(
+        chrono::steady_clock::now() - start).count();
+}
+
+levelgen_stage_timer::~levelgen_stage_timer()
+{
+    if (crawl_state.level_gen_bench)
+        stage_timings[stage].add(_usecs_since(start));
+}
+
+levelgen_vault_timer::~levelgen_vault_timer()
+{
+    if (crawl_state.level_gen_bench)
+        vault_timings[name].add(_usecs_since(start));
+}
+
 void mapstat_report_map_build_start()
 {
     build_attempts++;
@@ -92,7 +137,11 @@ static bool _do_build_level()
     }
 
     ++levels_tried;
-    if (!builder())
+    const auto build_start = chrono::steady_clock::now();
+    const bool built = builder();
+    if (crawl_state.level_gen_bench)
+        level_timings[level_id::current()].add(_usecs_since(build_start));
+    if (!built)
     {
         ++levels_failed;
         // Abort level build failure in objstat since the statistics will be
@@ -260,6 +309,10 @@ bool mapstat_build_levels()
              build_attempts ? level_vetoes * 100.0 / build_attempts : 0.0);
         printf("%d..", i + 1);
         fflush(stdout);
+        // Give each benchmark iteration its own (reproducible) seed, so
+        // runs on different builds generate the same levels.
+        if (crawl_state.level_gen_bench)
+            seed_rng(crawl_state.seed + i);
         dlua.callfn("dgn_clear_data", "");
         you.uniq_map_tags.clear();
         you.uniq_map_names.clear();
@@ -485,6 +538,83 @@ static void _write_map_stats()
     printf("\n");
 }
 
+static void _write_levelgen_bench()
+{
+    const char *out_file = "levelgen-bench.log";
+    FILE *outf = fopen(out_file, "w");
+    if (!outf)
+    {
+        printf("Couldn't open %s\n", out_file);
+        return;
+    }
+    printf("Writing level generation benchmark to %s...\n", out_file);
+
+    const levelgen_timing &attempts = stage_timings[LGS_ATTEMPT];
+    fprintf(outf, "Level Generation Benchmark\n\n");
+    fprintf(outf, "Levels attempted: %d, failed: %d, build attempts: %d, "
+            "vetoes: %d, seeds %" PRIu64 "-%" PRIu64 "\n",
+            levels_tried, levels_failed, build_attempts, level_vetoes,
+            crawl_state.seed,
+            crawl_state.seed + max(SysEnv.map_gen_iters - 1, 0));
+
+    fprintf(outf, "\n%-16s %12s %8s %10s %10s %7s\n", "Stage", "total ms",
+            "calls", "avg ms", "max ms", "% time");
+    for (int i = 0; i < NUM_LEVELGEN_STAGES; ++i)
+    {
+        const levelgen_timing &t = stage_timings[i];
+        const string line = make_stringf("%-16s %12.1f %8d %10.3f %10.3f "
+                                         "%6.1f%%",
+            levelgen_stage_names[i], t.usecs / 1000.0, t.count,
+            t.count ? t.usecs / 1000.0 / t.count : 0.0, t.max_usecs / 1000.0,
+            attempts.usecs ? t.usecs * 100.0 / attempts.usecs : 0.0);
+        fprintf(outf, "%s\n", line.c_str());
+        printf("%s\n", line.c_str());
+    }
+
+    fprintf(outf, "\n%-20s %8s %10s %10s %9s %7s\n", "Place", "levels",
+            "avg ms", "max ms", "attempts", "vetoes");
+    for (const auto &entry : level_timings)
+    {
+        const levelgen_timing &t = entry.second;
+        const pair<int, int> &builds = map_builds[entry.first];
+        fprintf(outf, "%-20s %8d %10.3f %10.3f %9d %7d\n",
+                entry.first.describe().c_str(), t.count,
+                t.usecs / 1000.0 / t.count, t.max_usecs / 1000.0,
+                builds.first, builds.second);
+    }
+
+    vector<pair<string, int>> vetoes(veto_messages.begin(),
+                                     veto_messages.end());
+    sort(vetoes.begin(), vetoes.end(),
+         [](const pair<string, int> &a, const pair<string, int> &b)
+         { return a.second > b.second; });
+    fprintf(outf, "\nVetoes by reason:\n");
+    for (const auto &veto : vetoes)
+        fprintf(outf, "%7d  %s\n", veto.second, veto.first.c_str());
+
+    // Vault times include any subvaults they place.
+    vector<pair<string, levelgen_timing>> vaults(vault_timings.begin(),
+                                                 vault_timings.end());
+    sort(vaults.begin(), vaults.end(),
+         [](const pair<string, levelgen_timing> &a,
+            const pair<string, levelgen_timing> &b)
+         { return a.second.usecs > b.second.usecs; });
+    if (vaults.size() > 50)
+        vaults.resize(50);
+    fprintf(outf, "\nSlowest vaults by total placement time:\n");
+    fprintf(outf, "%-40s %8s %12s %10s %10s\n", "Vault", "tries",
+            "total ms", "avg ms", "max ms");
+    for (const auto &vault : vaults)
+    {
+        const levelgen_timing &t = vault.second;
+        fprintf(outf, "%-40s %8d %12.1f %10.3f %10.3f\n",
+                vault.first.c_str(), t.count, t.usecs / 1000.0,
+                t.usecs / 1000.0 / t.count, t.max_usecs / 1000.0);
+    }
+
+    fclose(outf);
+}
+
 bool mapstat_find_forced_map()
 {
     const map_def *map = find_map_by_name(crawl_state.force_map);
@@ -533,6 +663,13 @@ void mapstat_generate_stats()
 
     mapstat_build_levels();
 
+    if (crawl_state.level_gen_bench)
+    {
+        _write_levelgen_bench();
+        printf("Level generation benchmark complete.\n");
+        return;
+    }
+
     _write_map_stats();
     printf("Map stats complete.\n");
 }
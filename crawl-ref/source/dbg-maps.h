@@ -7,6 +7,60 @@
 
 #ifdef DEBUG_STATISTICS
 
+#include <chrono>
+
+// Parts of a level build timed by -bench-levelgen.
+enum levelgen_stage_type
+{
+    LGS_LAYOUT,         // Layout and primary vault.
+    LGS_VAULTS,         // Branch entrances, chance, mini- and extra vaults.
+    LGS_CONNECTIVITY,   // Connectivity checks and stair fixups.
+    LGS_MONSTERS,
+    LGS_ITEMS,
+    LGS_VALIDATION,     // Checks on the finished level.
+    LGS_ATTEMPT,        // A whole build attempt, vetoed or not.
+    NUM_LEVELGEN_STAGES
+};
+
+/**
+ * Adds the time between its construction and destruction to a builder
+ * stage's total, when benchmarking level generation. Vetoes unwind through
+ * it, so vetoed work is counted too.
+ */
+class levelgen_stage_timer
+{
+public:
+    explicit levelgen_stage_timer(levelgen_stage_type s)
+        : stage(s), start(chrono::steady_clock::now())
+    {
+    }
+    ~levelgen_stage_timer();
+
+private:
+    levelgen_stage_type stage;
+    chrono::steady_clock::time_point start;
+};
+
+/// Like levelgen_stage_timer, but times a single vault placement attempt.
+class levelgen_vault_timer
+{
+public:
+    explicit levelgen_vault_timer(const string &map_name)
+        : name(map_name), start(chrono::steady_clock::now())
+    {
+    }
+    ~levelgen_vault_timer();
+
+private:
+    string name;
+    chrono::steady_clock::time_point start;
+};
+
+# define LGS_CONCAT_(a, b) a##b
+# define LGS_CONCAT(a, b) LGS_CONCAT_(a, b)
+# define LEVELGEN_STAGE(s) \
+    levelgen_stage_timer LGS_CONCAT(levelgen_timer_, __LINE__)(s)
+
 class map_def;
 void mapstat_report_map_try(const map_def &map);
 void mapstat_report_map_use(const map_def &map);
@@ -17,4 +71,9 @@ void mapstat_report_map_veto(const string &message);
 void mapstat_generate_stats();
 bool mapstat_build_levels();
 bool mapstat_find_forced_map();
+
+#else
+
+# define LEVELGEN_STAGE(s) ((void) 0)
+
 #endif
@@ -58,6 +58,8 @@ void debug_item_scan()
         if (*ri == coord_def())
             continue;
 
+        bool chain_ok = true;
+
         // Looking for infinite stacks (ie more links than items allowed)
         // and for items which have bad coordinates (can't find their stack)
         for (int obj = igrd(*ri); obj != NON_ITEM; obj = mitm[obj].link)
@@ -76,6 +78,7 @@ void debug_item_scan()
                                       "invalid link %d",
                          ri->x, ri->y, obj);
                 }
+                chain_ok = false;
                 break;
             }
 
@@ -99,10 +102,26 @@ void debug_item_scan()
             {
                 mprf(MSGCH_ERROR,
                      "Potential INFINITE STACK at (%d, %d)", ri->x, ri->y);
+                chain_ok = false;
                 break;
             }
             visited.set(obj);
         }
+
+        // A pile list that isn't due to be rebuilt must match its chain.
+        if (chain_ok && !env.item_piles.stale(*ri))
+        {
+            const vector<int> &pile = env.item_piles.pile(*ri);
+            int obj = igrd(*ri);
+            size_t n = 0;
+            for (; obj != NON_ITEM && n < pile.size() && pile[n] == obj; ++n)
+                obj = mitm[obj].link;
+            if (obj != NON_ITEM || n != pile.size())
+            {
+                mprf(MSGCH_ERROR, "Item pile index out of sync at (%d, %d)",
+                     ri->x, ri->y);
+            }
+        }
     }
 
     // Now scan all the items on the level:
@@ -333,6 +352,13 @@ void debug_mons_scan()
         ASSERT(m->mid > 0);
         coord_def pos = m->pos();
 
+        if (!env.mons_index.used(i) || env.mons_index.pos(i) != pos)
+        {
+            mprf(MSGCH_ERROR, "Monster index out of sync for %s at (%d, %d), "
+                              "midx = %d",
+                 m->full_name(DESC_PLAIN).c_str(), pos.x, pos.y, i);
+        }
+
         if (invalid_monster_type(m->type))
         {
             mprf(MSGCH_ERROR, "Bogus monster type %d at (%d, %d), midx = %d",
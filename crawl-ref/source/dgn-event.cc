@@ -18,6 +18,7 @@ void dgn_event_dispatcher::clear()
 {
     global_event_mask = 0;
     listeners.clear();
+    wakeups.clear();
     for (int y = 0; y < GYM; ++y)
         for (int x = 0; x < GXM; ++x)
             grid_triggers[x][y].reset(nullptr);
@@ -53,6 +54,7 @@ bool dgn_event_dispatcher::fire_vetoable_position_event(
     dgn_square_alarm *alarm = grid_triggers[pos.x][pos.y].get();
     if (alarm && (alarm->eventmask & et.type))
     {
+        flush_wakeups();
         dgn_square_alarm alcopy(*alarm);
         for (auto listener : alcopy.listeners)
             if (!listener->notify_dgn_event(et))
@@ -74,6 +76,7 @@ void dgn_event_dispatcher::fire_position_event(
     dgn_square_alarm *alarm = grid_triggers[pos.x][pos.y].get();
     if (alarm && (alarm->eventmask & et.type))
     {
+        flush_wakeups();
         dgn_square_alarm alcopy = *alarm;
         for (auto listener : alcopy.listeners)
             listener->notify_dgn_event(et);
@@ -82,12 +85,82 @@ void dgn_event_dispatcher::fire_position_event(
 
 void dgn_event_dispatcher::fire_event(const dgn_event &e)
 {
+    // Anything else a sleeping listener hears must come after the time it
+    // would already have been told about.
     if (global_event_mask & e.type)
     {
+        if (e.type != DET_TURN_ELAPSED)
+            flush_wakeups();
+
         auto copy = listeners;
         for (const auto &ldef : copy)
-            if (ldef.eventmask & e.type)
+        {
+            if (!(ldef.eventmask & e.type))
+                continue;
+            if (e.type == DET_TURN_ELAPSED)
+                notify_turn_elapsed(ldef.listener, e);
+            else
                 ldef.listener->notify_dgn_event(e);
+        }
+    }
+}
+
+void dgn_event_dispatcher::notify_turn_elapsed(dgn_event_listener *listener,
+                                               const dgn_event &e)
+{
+    auto wakeup = wakeups.find(listener);
+    if (wakeup == wakeups.end())
+    {
+        listener->notify_dgn_event(e);
+        return;
+    }
+
+    wakeup->second.banked += e.elapsed_ticks;
+    if (wakeup->second.banked < wakeup->second.ticks)
+        return;
+
+    dgn_event late(e);
+    late.elapsed_ticks = wakeup->second.banked;
+    wakeups.erase(wakeup);
+    listener->notify_dgn_event(late);
+}
+
+/**
+ * Stop telling a global listener about DET_TURN_ELAPSED until at least the
+ * given number of ticks have passed, at which point it gets one event for
+ * all of them. Any other event it would hear wakes it early, so a listener
+ * only needs to work out when the passing of time alone would matter to it.
+ * Listeners must reschedule each time they are woken.
+ */
+void dgn_event_dispatcher::schedule_wakeup(dgn_event_listener *listener,
+                                           int ticks)
+{
+    if (ticks <= 0)
+        wakeups.erase(listener);
+    else
+        wakeups[listener] = dgn_wakeup(ticks);
+}
+
+/// Hand every sleeping listener the time it has banked so far.
+void dgn_event_dispatcher::flush_wakeups()
+{
+    if (wakeups.empty())
+        return;
+
+    const auto sleepers = wakeups;
+    wakeups.clear();
+
+    // In registration order, as they would have been told anyway.
+    auto copy = listeners;
+    for (const auto &ldef : copy)
+    {
+        auto wakeup = sleepers.find(ldef.listener);
+        if (wakeup != sleepers.end() && wakeup->second.banked)
+        {
+            ldef.listener->notify_dgn_event(
+                dgn_event(DET_TURN_ELAPSED, coord_def(),
+                          wakeup->second.banked));
+        }
     }
 }
 
@@ -140,6 +213,7 @@ void dgn_event_dispatcher::remove_listener(dgn_event_listener *listener,
         remove_listener_at(pos, listener);
     else
     {
+        wakeups.erase(listener);
         for (auto i = listeners.begin(); i != listeners.end(); ++i)
         {
             if (i->listener == listener)
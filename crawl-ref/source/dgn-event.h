@@ -6,6 +6,7 @@
 #pragma once
 
 #include <list>
+#include <map>
 
 #include "player.h"
 
@@ -90,6 +91,16 @@ struct dgn_listener_def
     dgn_event_listener *listener;
 };
 
+// A listener that has asked not to hear about DET_TURN_ELAPSED until some
+// time has passed; the time is banked and delivered in one event.
+struct dgn_wakeup
+{
+    dgn_wakeup(int t = 0) : ticks(t), banked(0) { }
+
+    int ticks;
+    int banked;
+};
+
 // Listeners are not saved here. Map markers have their own
 // persistence and activation mechanisms. Other listeners must make
 // their own persistence arrangements.
@@ -121,15 +132,20 @@ public:
                            const coord_def &pos = coord_def());
     void remove_listener(dgn_event_listener *,
                          const coord_def &pos = coord_def());
+
+    void schedule_wakeup(dgn_event_listener *, int ticks);
+    void flush_wakeups();
 private:
     void register_listener_at(unsigned mask, const coord_def &pos,
                               dgn_event_listener *l);
     void remove_listener_at(const coord_def &pos, dgn_event_listener *l);
+    void notify_turn_elapsed(dgn_event_listener *l, const dgn_event &e);
 
 private:
     unsigned global_event_mask;
     unique_ptr<dgn_square_alarm> grid_triggers[GXM][GYM];
     list<dgn_listener_def> listeners;
+    map<dgn_event_listener *, dgn_wakeup> wakeups;
 };
 
 extern dgn_event_dispatcher dungeon_events;
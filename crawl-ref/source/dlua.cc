@@ -177,6 +177,23 @@ int dlua_chunk::load(CLua &interp)
     return err;
 }
 
+// Compiles the source without running it, so that the chunk is written
+// out as bytecode. A chunk that fails to compile stays as source, so that
+// the error is still reported when it's used.
+void dlua_chunk::precompile(CLua &interp)
+{
+    if (!compiled.empty() || trimmed_string(chunk).empty())
+        return;
+
+    lua_stack_cleaner cln(interp);
+    if (interp.loadstring(chunk.c_str(), context.c_str()))
+        return;
+
+    ostringstream out;
+    if (!lua_dump(interp, dlua_compiled_chunk_writer, &out))
+        compiled = out.str();
+}
+
 int dlua_chunk::run(CLua &interp)
 {
     int err = load(interp);
@@ -316,6 +316,7 @@ static bool _build_level_vetoable(bool enable_random_maps,
 #ifdef DEBUG_STATISTICS
     mapstat_report_map_build_start();
 #endif
+    LEVELGEN_STAGE(LGS_ATTEMPT);
 
     dgn_reset_level(enable_random_maps);
 
@@ -340,10 +341,13 @@ static bool _build_level_vetoable(bool enable_random_maps,
 
     _dgn_set_floor_colours();
 
-    if (crawl_state.game_standard_levelgen()
-        && !_valid_dungeon_level())
     {
-        return false;
+        LEVELGEN_STAGE(LGS_VALIDATION);
+        if (crawl_state.game_standard_levelgen()
+            && !_valid_dungeon_level())
+        {
+            return false;
+        }
     }
 
 #ifdef DEBUG_MONS_SCAN
@@ -768,38 +772,37 @@ static bool _dgn_fill_zone(
     bool (*iswanted)(const coord_def &) = nullptr)
 {
     bool ret = false;
-    list<coord_def> points[2];
-    int cur = 0;
+    // The builder floods the whole map many times per level, so keep the
+    // frontier around rather than allocating for every point. The order
+    // points are visited in doesn't matter: the whole zone gets marked.
+    static vector<coord_def> points;
+    points.clear();
 
     // No bounds checks, assuming the level has at least one layer of
     // rock border.
 
-    for (points[cur].push_back(start); !points[cur].empty();)
+    travel_point_distance[start.x][start.y] = zone;
+    for (points.push_back(start); !points.empty();)
     {
-        for (const auto &c : points[cur])
-        {
-            travel_point_distance[c.x][c.y] = zone;
+        const coord_def c = points.back();
+        points.pop_back();
 
-            if (iswanted && iswanted(c))
-                ret = true;
+        if (iswanted && iswanted(c))
+            ret = true;
 
-            for (adjacent_iterator ai(c); ai; ++ai)
+        for (adjacent_iterator ai(c); ai; ++ai)
+        {
+            const coord_def& cp = *ai;
+            if (!map_bounds(cp)
+                || travel_point_distance[cp.x][cp.y] || !passable(cp))
             {
-                const coord_def& cp = *ai;
-                if (!map_bounds(cp)
-                    || travel_point_distance[cp.x][cp.y] || !passable(cp))
-                {
-                    continue;
-                }
-
-                travel_point_distance[cp.x][cp.y] = zone;
-                record_point(cp);
-                points[!cur].push_back(cp);
+                continue;
             }
-        }
 
-        points[cur].clear();
-        cur = !cur;
+            travel_point_distance[cp.x][cp.y] = zone;
+            record_point(cp);
+            points.push_back(cp);
+        }
     }
     return ret;
 }
@@ -929,9 +932,18 @@ static int _process_disconnected_zones(int x1, int y1, int x2, int y2,
                 continue;
             }
 
+            // Remember the zone as we flood it, in case we fill it in.
+            vector<coord_def> coords;
+            auto record_point = [&](const coord_def &c)
+            {
+                if (fill && c.x >= x1 && c.x <= x2 && c.y >= y1 && c.y <= y2)
+                    coords.push_back(c);
+            };
+            record_point(coord_def(x, y));
+
             const bool found_exit_stair =
                 _dgn_fill_zone(coord_def(x, y), ++nzones,
-                               _dgn_point_record_stub,
+                               record_point,
                                _dgn_square_is_passable,
                                choose_stairless ? (at_branch_bottom() ?
                                                    _is_upwards_exit_stair :
@@ -947,26 +959,8 @@ static int _process_disconnected_zones(int x1, int y1, int x2, int y2,
                 // We want vaults to be accessible; if the area is disconneted
                 // from the rest of the level, this will cause the level to be
                 // vetoed later on.
-                bool veto = false;
-                vector<coord_def> coords;
-                for (int fy = y1; fy <= y2 ; ++fy)
-                {
-                    for (int fx = x1; fx <= x2; ++fx)
-                    {
-                        if (travel_point_distance[fx][fy] == nzones)
-                        {
-                            if (map_masked(coord_def(fx, fy), MMT_VAULT))
-                            {
-                                veto = true;
-                                break;
-                            }
-                            else
-                                coords.emplace_back(fx, fy);
-                        }
-                    }
-                    if (veto)
-                        break;
-                }
+                const bool veto = any_of(coords.begin(), coords.end(),
+                    [](const coord_def &c) { return map_masked(c, MMT_VAULT); });
                 if (!veto)
                 {
                     for (auto c : coords)
@@ -1270,6 +1264,7 @@ void dgn_reset_level(bool enable_random_maps)
 
     mgrd.init(NON_MONSTER);
     igrd.init(NON_ITEM);
+    env.item_piles.clear();
 
     // Reset all shops.
     env.shop.clear();
@@ -1436,9 +1431,7 @@ void fixup_misplaced_items()
         }
 
         // Can't just unlink item because it might not have been linked yet.
-        item.base_type = OBJ_UNASSIGNED;
-        item.quantity = 0;
-        item.pos.reset();
+        init_item(item.index());
     }
 }
 
@@ -2373,10 +2366,17 @@ static void _post_vault_build()
 
 static void _build_dungeon_level(dungeon_feature_type dest_stairs_type)
 {
-    bool place_vaults = _builder_by_type();
+    bool place_vaults;
+    {
+        LEVELGEN_STAGE(LGS_LAYOUT);
+        place_vaults = _builder_by_type();
+    }
 
     if (player_in_branch(BRANCH_SLIME))
+    {
+        LEVELGEN_STAGE(LGS_CONNECTIVITY);
         _slime_connectivity_fixup();
+    }
 
     // Now place items, mons, gates, etc.
     // Stairs must exist by this point (except in Shoals where they are
@@ -2392,6 +2392,7 @@ static void _build_dungeon_level(dungeon_feature_type dest_stairs_type)
     if (player_in_branch(BRANCH_DUNGEON)
         && !crawl_state.game_is_tutorial())
     {
+        LEVELGEN_STAGE(LGS_VAULTS);
         _build_overflow_temples();
     }
 
@@ -2399,22 +2400,25 @@ static void _build_dungeon_level(dungeon_feature_type dest_stairs_type)
     // no guarantees, seeing this is a minivault.
     if (crawl_state.game_standard_levelgen())
     {
-        if (place_vaults)
-        {
-            // Moved branch entries to place first so there's a good
-            // chance of having room for a vault
-            _place_branch_entrances(true);
-            _place_chance_vaults();
-            _place_minivaults();
-            _place_extra_vaults();
-        }
-        else
         {
-            // Place any branch entries vaultlessly
-            _place_branch_entrances(false);
-            // Still place chance vaults - important things like Abyss,
-            // Hell, Pan entries are placed this way
-            _place_chance_vaults();
+            LEVELGEN_STAGE(LGS_VAULTS);
+            if (place_vaults)
+            {
+                // Moved branch entries to place first so there's a good
+                // chance of having room for a vault
+                _place_branch_entrances(true);
+                _place_chance_vaults();
+                _place_minivaults();
+                _place_extra_vaults();
+            }
+            else
+            {
+                // Place any branch entries vaultlessly
+                _place_branch_entrances(false);
+                // Still place chance vaults - important things like Abyss,
+                // Hell, Pan entries are placed this way
+                _place_chance_vaults();
+            }
         }
 
         // Ruination and plant clumps.
@@ -2422,7 +2426,10 @@ static void _build_dungeon_level(dungeon_feature_type dest_stairs_type)
 
         // XXX: Moved this here from builder_monsters so that
         //      connectivity can be ensured
-        _place_uniques();
+        {
+            LEVELGEN_STAGE(LGS_MONSTERS);
+            _place_uniques();
+        }
 
         if (_mimic_at_level())
             _place_feature_mimics(dest_stairs_type);
@@ -2430,12 +2437,21 @@ static void _build_dungeon_level(dungeon_feature_type dest_stairs_type)
         _place_traps();
 
         // Any vault-placement activity must happen before this check.
-        _dgn_verify_connectivity(nvaults);
+        {
+            LEVELGEN_STAGE(LGS_CONNECTIVITY);
+            _dgn_verify_connectivity(nvaults);
+        }
 
-        _builder_monsters();
+        {
+            LEVELGEN_STAGE(LGS_MONSTERS);
+            _builder_monsters();
+        }
 
         // Place items.
-        _builder_items();
+        {
+            LEVELGEN_STAGE(LGS_ITEMS);
+            _builder_items();
+        }
 
         _fixup_walls();
     }
@@ -4122,6 +4138,10 @@ static const vault_placement *_build_vault_impl(const map_def *vault,
                   bool build_only, bool check_collisions,
                   bool make_no_exits, const coord_def &where)
 {
+#ifdef DEBUG_STATISTICS
+    levelgen_vault_timer vault_timer(vault->name);
+#endif
+
     if (dgn_check_connectivity && !dgn_zones)
     {
         dgn_zones = dgn_count_disconnected_zones(false);
@@ -4299,6 +4319,7 @@ static int _dgn_item_corpse(const item_spec &ispec, const coord_def where)
         if (!mon)
             continue;
         mon->position = where;
+        env.mons_index.set_pos(mon->mindex(), where);
         corpse = place_monster_corpse(*mon, true, true);
         // Dismiss the monster we used to place the corpse.
         mon->flags |= MF_HARD_RESET;
@@ -5667,7 +5688,7 @@ static void _stock_shop_item(int j, shop_type shop_type_,
             // if this book type is already in the shop, maybe discard it
             if (!one_chance_in(stocked[mitm[item_index].sub_type] + 1))
             {
-                mitm[item_index].clear();
+                init_item(item_index);
                 item_index = NON_ITEM; // try again
             }
         }
@@ -5677,7 +5698,7 @@ static void _stock_shop_item(int j, shop_type shop_type_,
 
         // Reset object and try again.
         if (item_index != NON_ITEM)
-            mitm[item_index].clear();
+            init_item(item_index);
     }
 
     ASSERT(item_index != NON_ITEM);
@@ -5,7 +5,9 @@
 
 #include "coord.h"
 #include "fprop.h"
+#include "item-piles.h"
 #include "map-cell.h"
+#include "mon-index.h"
 #include "monster.h"
 #include "trap-def.h"
 
@@ -26,11 +28,13 @@ struct crawl_environment
 
     FixedVector< item_def, MAX_ITEMS >       item;  // item list
     FixedVector< monster, MAX_MONSTERS+2 >   mons;  // monster list, plus anon
+    monster_index                            mons_index; // used mons slots
 
     feature_grid                             grid;  // terrain grid
     FixedArray<terrain_property_t, GXM, GYM> pgrid; // terrain properties
     FixedArray< unsigned short, GXM, GYM >   mgrid; // monster grid
     FixedArray< int, GXM, GYM >              igrid; // item grid
+    item_pile_index                          item_piles; // igrid as lists
     FixedArray< unsigned short, GXM, GYM >   grid_colours; // colour overrides
 
     map_mask                                 level_map_mask;
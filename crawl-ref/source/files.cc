@@ -82,6 +82,7 @@
 #include "tileview.h"
 #include "tiles-build-specific.h"
 #include "timed-effects.h"
+#include "turn-profile.h"
 #include "unwind.h"
 #include "version.h"
 #include "view.h"
@@ -1486,7 +1487,9 @@ bool load_level(dungeon_feature_type stair_taken, load_mode_type load_mode,
     if (make_changes)
         delete_all_clouds();
 
-    // Lose all listeners.
+    // Lose all listeners, first handing markers waiting on a wakeup the
+    // time they have banked in the dispatcher, which isn't saved.
+    dungeon_events.flush_wakeups();
     dungeon_events.clear();
 
     // This block is to grab followers and save the old level to disk.
@@ -1823,12 +1826,92 @@ static void _save_level(const level_id& lid)
         savefn(w);                              \
     } while (false)
 
+// The travel cache and stash tracker keep each level's data in a chunk of
+// its own, and a save only rewrites the chunks whose contents changed.
+// These are the contents last written to, or read from, each such chunk.
+static map<string, vector<unsigned char>> level_chunks;
+static const package *level_chunks_save = nullptr;
+
+static map<string, vector<unsigned char>> &_level_chunks()
+{
+    if (level_chunks_save != you.save)
+    {
+        level_chunks.clear();
+        level_chunks_save = you.save;
+    }
+    return level_chunks;
+}
+
+static string _level_chunk_name(const string &prefix, const level_id &lid)
+{
+    return prefix + "." + lid.describe();
+}
+
+static void _save_level_chunks(const string &prefix,
+                               const vector<level_id> &levels,
+                               function<void(writer&, const level_id&)> savefn)
+{
+    auto &chunks = _level_chunks();
+    set<string> current;
+    for (const level_id &lid : levels)
+    {
+        const string name = _level_chunk_name(prefix, lid);
+        current.insert(name);
+
+        vector<unsigned char> buf;
+        writer w(&buf);
+        savefn(w, lid);
+
+        vector<unsigned char> &last = chunks[name];
+        if (buf == last && you.save->has_chunk(name))
+            continue;
+
+        writer out(you.save, name);
+        out.write(buf.data(), buf.size());
+        last.swap(buf);
+    }
+
+    // Drop the chunks of levels that have been forgotten.
+    for (auto it = chunks.begin(); it != chunks.end();)
+    {
+        if (starts_with(it->first, prefix + ".")
+            && !current.count(it->first))
+        {
+            if (you.save->has_chunk(it->first))
+                you.save->delete_chunk(it->first);
+            it = chunks.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
+static void _load_level_chunk(const string &prefix, const level_id &lid,
+                              int minorVersion,
+                              function<void(reader&)> loadfn)
+{
+    const string name = _level_chunk_name(prefix, lid);
+    if (!you.save->has_chunk(name))
+        end(1, false, "Save data is invalid: missing %s.", name.c_str());
+
+    vector<char> data;
+    chunk_reader(you.save, name).read_all(data);
+    vector<unsigned char> &buf = _level_chunks()[name];
+    buf.assign(data.begin(), data.end());
+
+    reader inf(buf, minorVersion);
+    loadfn(inf);
+}
+
 // Stack allocated string's go in separate function, so Valgrind doesn't
 // complain.
 static void _save_game_base()
 {
     /* Stashes */
     SAVEFILE("st", "stashes", StashTrack.save);
+    _save_level_chunks(CHUNK("st", "stashes"), StashTrack.known_levels(),
+                       [](writer &w, const level_id &lid)
+                       { StashTrack.save_level(w, lid); });
 
 #ifdef CLUA_BINDINGS
     /* lua */
@@ -1840,6 +1923,10 @@ static void _save_game_base()
 
     /* travel cache */
     SAVEFILE("tc", "travel_cache", travel_cache.save);
+    _save_level_chunks(CHUNK("tc", "travel_cache"),
+                       travel_cache.known_levels(),
+                       [](writer &w, const level_id &lid)
+                       { travel_cache.save_level(w, lid); });
 
     /* notes */
     SAVEFILE("nts", "notes", save_notes);
@@ -1877,7 +1964,10 @@ static void _save_game_exit()
 
     // Must be exiting -- save level & goodbye!
     if (!you.entering_level)
+    {
+        dungeon_events.flush_wakeups();
         _save_level(level_id::current());
+    }
 
     clrscr();
 
@@ -1934,6 +2024,7 @@ void save_game(bool leave_game, const char *farewellmsg)
 // Saves the game without exiting.
 void save_game_state()
 {
+    PROFILE_SECTION(PROF_SAVE);
     save_game(false);
     if (crawl_state.seen_hups)
         save_game(true);
@@ -2033,23 +2124,29 @@ static string _bones_permastore_file()
 /**
  * Lists all bonefiles for the current level.
  *
- * @return A vector containing absolute paths to 0+ bonefiles.
+ * _make_bones_file() only ever creates base_N for N < GHOST_LIMIT, so the
+ * names themselves are the index: probe those directly rather than listing
+ * a bones directory that may hold every level's files on a busy server.
+ *
+ * @return A vector containing absolute paths to 0+ bonefiles, in the same
+ *         (lexicographic) order a sorted directory listing would give.
  */
 static vector<string> _list_bones()
 {
     string bonefile_dir = _get_bonefile_directory();
     string base_filename = _make_ghost_filename();
-    string underscored_filename = base_filename + "_";
 
-    vector<string> filenames = get_dir_files_sorted(bonefile_dir);
     vector<string> bonefiles;
-    for (const auto &filename : filenames)
-        if (starts_with(filename, underscored_filename)
-                                            && !ends_with(filename, ".backup"))
-        {
-            bonefiles.push_back(bonefile_dir + filename);
-            _ghost_dprf("bonesfile %s", (bonefile_dir + filename).c_str());
-        }
+    for (int i = 0; i < GHOST_LIMIT; i++)
+    {
+        const string filename = make_stringf("%s%s_%d", bonefile_dir.c_str(),
+                                             base_filename.c_str(), i);
+        if (file_exists(filename))
+            bonefiles.push_back(filename);
+    }
+    sort(bonefiles.begin(), bonefiles.end());
+    for (const string &filename : bonefiles)
+        _ghost_dprf("bonesfile %s", filename.c_str());
 
     string old_bonefile = _get_old_bonefile_directory() + base_filename;
     if (access(old_bonefile.c_str(), F_OK) == 0)
@@ -2495,7 +2592,11 @@ static bool _restore_game(const string& filename)
     if (you.save->has_chunk(CHUNK("st", "stashes")))
     {
         reader inf(you.save, CHUNK("st", "stashes"), minorVersion);
-        StashTrack.load(inf);
+        for (const level_id &lid : StashTrack.load(inf))
+        {
+            _load_level_chunk(CHUNK("st", "stashes"), lid, minorVersion,
+                              [](reader &lin) { StashTrack.load_level(lin); });
+        }
     }
 
 #ifdef CLUA_BINDINGS
@@ -2518,7 +2619,13 @@ static bool _restore_game(const string& filename)
     if (you.save->has_chunk(CHUNK("tc", "travel_cache")))
     {
         reader inf(you.save, CHUNK("tc", "travel_cache"), minorVersion);
-        travel_cache.load(inf, minorVersion);
+        for (const level_id &lid : travel_cache.load(inf, minorVersion))
+        {
+            _load_level_chunk(CHUNK("tc", "travel_cache"), lid, minorVersion,
+                [&lid, minorVersion](reader &lin)
+                { travel_cache.load_level(lin, lid, minorVersion); });
+        }
+        travel_cache.fixup_levels();
     }
 
     if (you.save->has_chunk(CHUNK("nts", "notes")))
@@ -2620,6 +2727,7 @@ void level_excursion::go_to(const level_id& next)
     {
         ever_changed_levels = true;
 
+        dungeon_events.flush_wakeups();
         _save_level(level_id::current());
         _load_level(next);
 
@@ -0,0 +1,455 @@
+/**
+ * @file
+ * @brief Starting games by forking a process that has already loaded the
+ *        game data.
+ *
+ * A client connects to the server's socket and sends its stdin, stdout and
+ * stderr along with a request: its working directory, its command line and
+ * its environment, as NUL-terminated strings. The server forks, and the
+ * child takes on the client's descriptors, directory and environment before
+ * carrying on with startup as if it had been run with that command line.
+ * The server replies with the game's pid, and later with its wait status,
+ * which the client exits with. Signals the client receives are passed on to
+ * the game, so that whatever launched the client can treat it as the game.
+**/
+
+#include "AppHdr.h"
+
+#include "fork-server.h"
+
+#ifdef USE_FORK_SERVER
+
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <map>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "end.h"
+#include "initfile.h"
+#include "libutil.h"
+#include "mapdef.h" // depth_ranges, for resetting SysEnv
+#include "startup.h"
+
+extern char **environ;
+
+// The descriptors a client hands over: its stdin, stdout and stderr.
+#define FORK_FDS 3
+
+// No sane command line and environment come anywhere near this.
+#define MAX_FORK_REQUEST (1 << 20)
+
+struct fork_request
+{
+    int fds[FORK_FDS];
+    string cwd;
+    vector<string> args;
+    vector<string> env;
+};
+
+static volatile sig_atomic_t _games_exited = 0;
+static pid_t _game_pid = 0;
+
+static void _note_game_exit(int)
+{
+    _games_exited = 1;
+}
+
+static void _pass_on_signal(int sig)
+{
+    if (_game_pid > 0)
+        kill(_game_pid, sig);
+}
+
+static bool _write_all(int fd, const void *buf, size_t len)
+{
+    const char *p = static_cast<const char *>(buf);
+    while (len)
+    {
+        const ssize_t n = write(fd, p, len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool _read_all(int fd, void *buf, size_t len)
+{
+    char *p = static_cast<char *>(buf);
+    while (len)
+    {
+        const ssize_t n = read(fd, p, len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool _socket_address(const string &path, sockaddr_un &addr)
+{
+    if (path.size() >= sizeof(addr.sun_path))
+        return false;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path.c_str());
+    return true;
+}
+
+static void _close_fds(const int (&fds)[FORK_FDS])
+{
+    for (int fd : fds)
+        if (fd >= 0)
+            close(fd);
+}
+
+static bool _receive_request(int conn, fork_request &req)
+{
+    for (int &fd : req.fds)
+        fd = -1;
+
+    uint32_t len = 0;
+    char control[CMSG_SPACE(sizeof(req.fds))];
+    iovec iov = { &len, sizeof(len) };
+    msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    ssize_t got;
+    do
+        got = recvmsg(conn, &msg, 0);
+    while (got < 0 && errno == EINTR);
+
+    if (got <= 0)
+        return false;
+
+    const cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    if (cmsg && cmsg->cmsg_level == SOL_SOCKET
+        && cmsg->cmsg_type == SCM_RIGHTS
+        && cmsg->cmsg_len == CMSG_LEN(sizeof(req.fds)))
+    {
+        memcpy(req.fds, CMSG_DATA(cmsg), sizeof(req.fds));
+    }
+
+    if (req.fds[0] < 0 || (msg.msg_flags & MSG_CTRUNC))
+    {
+        _close_fds(req.fds);
+        return false;
+    }
+
+    // The length may have arrived in pieces; the descriptors came with the
+    // first of them.
+    const bool have_len = got == (ssize_t) sizeof(len)
+        || _read_all(conn, reinterpret_cast<char *>(&len) + got,
+                     sizeof(len) - got);
+
+    if (!have_len || len > MAX_FORK_REQUEST)
+    {
+        _close_fds(req.fds);
+        return false;
+    }
+
+    string payload(len, '\0');
+    if (len && !_read_all(conn, &payload[0], len))
+    {
+        _close_fds(req.fds);
+        return false;
+    }
+
+    vector<string> strings;
+    for (size_t start = 0; start < payload.size();)
+    {
+        const size_t end = payload.find('\0', start);
+        if (end == string::npos)
+            break;
+        strings.push_back(payload.substr(start, end - start));
+        start = end + 1;
+    }
+
+    // The working directory, the number of arguments, the arguments, and
+    // then the environment.
+    int nargs;
+    if (strings.size() < 2 || !parse_int(strings[1].c_str(), nargs)
+        || nargs < 1 || (size_t) nargs > strings.size() - 2)
+    {
+        _close_fds(req.fds);
+        return false;
+    }
+
+    req.cwd = strings[0];
+    req.args.assign(strings.begin() + 2, strings.begin() + 2 + nargs);
+    req.env.assign(strings.begin() + 2 + nargs, strings.end());
+    return true;
+}
+
+// Anyone who can start a game here chooses its rc file, directories and
+// environment, so only the server's own user may.
+static bool _peer_is_us(int conn)
+{
+#ifdef SO_PEERCRED
+    ucred cred;
+    socklen_t len = sizeof(cred);
+    return !getsockopt(conn, SOL_SOCKET, SO_PEERCRED, &cred, &len)
+           && cred.uid == geteuid();
+#else
+    uid_t uid;
+    gid_t gid;
+    return !getpeereid(conn, &uid, &gid) && uid == geteuid();
+#endif
+}
+
+static void _reap_games(map<pid_t, int> &games)
+{
+    int status;
+    pid_t pid;
+    while ((pid = waitpid(-1, &status, WNOHANG)) > 0)
+    {
+        auto game = games.find(pid);
+        if (game == games.end())
+            continue;
+
+        const int32_t wire_status = status;
+        _write_all(game->second, &wire_status, sizeof(wire_status));
+        close(game->second);
+        games.erase(game);
+    }
+}
+
+// Turn the freshly forked child into the game the client asked for.
+static void _become_game(const fork_request &req, int &argc, char **&argv)
+{
+    signal(SIGCHLD, SIG_DFL);
+    signal(SIGPIPE, SIG_DFL);
+
+    // Out of the server's session, so that nothing aimed at the server's
+    // terminal reaches the game.
+    setsid();
+
+    for (int i = 0; i < FORK_FDS; ++i)
+        dup2(req.fds[i], i);
+    for (int fd : req.fds)
+        if (fd >= FORK_FDS)
+            close(fd);
+
+    if (chdir(req.cwd.c_str()))
+    {
+        fprintf(stderr, "Can't change to %s: %s\n", req.cwd.c_str(),
+                strerror(errno));
+    }
+
+    vector<string> server_env;
+    for (char **e = environ; *e; ++e)
+        server_env.emplace_back(*e, strcspn(*e, "="));
+    for (const string &name : server_env)
+        unsetenv(name.c_str());
+    for (const string &entry : req.env)
+    {
+        const size_t eq = entry.find('=');
+        if (eq != string::npos && eq > 0)
+            setenv(entry.substr(0, eq).c_str(), entry.c_str() + eq + 1, 1);
+    }
+
+    static vector<string> game_args;
+    static vector<char *> game_argv;
+    game_args = req.args;
+    game_argv.clear();
+    for (string &arg : game_args)
+        game_argv.push_back(&arg[0]);
+    game_argv.push_back(nullptr);
+
+    argc = game_args.size();
+    argv = game_argv.data();
+
+    // Forget what the server made of its own environment and command line.
+    SysEnv = system_environment();
+}
+
+void run_fork_server(const string &socket_path, int &argc, char **&argv)
+{
+    sockaddr_un addr;
+    if (!_socket_address(socket_path, addr))
+        end(1, false, "Fork server socket path too long: %s",
+            socket_path.c_str());
+
+    preload_game_data();
+
+    const int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0)
+        end(1, true, "Can't create fork server socket");
+
+    // Create the socket owner-only from the start; the peer check below
+    // covers systems that ignore socket permissions.
+    unlink(socket_path.c_str());
+    const mode_t old_umask = umask(077);
+    const bool bound = !::bind(listener,
+                               reinterpret_cast<sockaddr *>(&addr),
+                               sizeof(addr));
+    umask(old_umask);
+    if (!bound || listen(listener, SOMAXCONN))
+        end(1, true, "Can't listen on %s", socket_path.c_str());
+
+    // No SA_RESTART: a game exiting should wake up the poll below.
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = _note_game_exit;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGCHLD, &sa, nullptr);
+
+    // A client going away mustn't take the server with it.
+    signal(SIGPIPE, SIG_IGN);
+
+    // Each game's client connection, to report its exit on.
+    map<pid_t, int> games;
+
+    while (true)
+    {
+        if (_games_exited)
+        {
+            _games_exited = 0;
+            _reap_games(games);
+        }
+
+        // The timeout covers a game exiting between the check above and
+        // the poll starting.
+        pollfd pfd = { listener, POLLIN, 0 };
+        if (poll(&pfd, 1, 1000) <= 0)
+            continue;
+
+        const int conn = accept(listener, nullptr, nullptr);
+        if (conn < 0)
+            continue;
+
+        fork_request req;
+        if (!_peer_is_us(conn) || !_receive_request(conn, req))
+        {
+            close(conn);
+            continue;
+        }
+
+        const pid_t pid = fork();
+        if (!pid)
+        {
+            close(listener);
+            close(conn);
+            for (const auto &game : games)
+                close(game.second);
+
+            _become_game(req, argc, argv);
+            return;
+        }
+
+        _close_fds(req.fds);
+        if (pid < 0)
+        {
+            // The client sees the connection close without a pid.
+            close(conn);
+            continue;
+        }
+
+        const int32_t wire_pid = pid;
+        _write_all(conn, &wire_pid, sizeof(wire_pid));
+        games[pid] = conn;
+    }
+}
+
+int fork_client(const char *socket_path, int argc, char **argv)
+{
+    sockaddr_un addr;
+    if (!_socket_address(socket_path, addr))
+    {
+        fprintf(stderr, "Fork server socket path too long: %s\n", socket_path);
+        return 1;
+    }
+
+    const int conn = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (conn < 0
+        || connect(conn, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)))
+    {
+        fprintf(stderr, "Can't connect to fork server at %s: %s\n",
+                socket_path, strerror(errno));
+        return 1;
+    }
+
+    char cwd[4096];
+    if (!getcwd(cwd, sizeof(cwd)))
+        strcpy(cwd, "/");
+
+    // argv[1] and argv[2] are -fork-client and the socket.
+    string payload = cwd;
+    payload += '\0';
+    payload += to_string(argc - 2);
+    payload += '\0';
+    payload += argv[0];
+    payload += '\0';
+    for (int i = 3; i < argc; ++i)
+    {
+        payload += argv[i];
+        payload += '\0';
+    }
+    for (char **e = environ; *e; ++e)
+    {
+        payload += *e;
+        payload += '\0';
+    }
+
+    const int fds[FORK_FDS] = { STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO };
+    uint32_t len = payload.size();
+    char control[CMSG_SPACE(sizeof(fds))];
+    memset(control, 0, sizeof(control));
+    iovec iov = { &len, sizeof(len) };
+    msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+    int32_t pid = 0;
+    if (sendmsg(conn, &msg, 0) != (ssize_t) sizeof(len)
+        || !_write_all(conn, payload.data(), payload.size())
+        || !_read_all(conn, &pid, sizeof(pid)))
+    {
+        fprintf(stderr, "Fork server at %s didn't start a game.\n",
+                socket_path);
+        return 1;
+    }
+
+    _game_pid = pid;
+    signal(SIGHUP, _pass_on_signal);
+    signal(SIGTERM, _pass_on_signal);
+    signal(SIGINT, _pass_on_signal);
+    signal(SIGQUIT, _pass_on_signal);
+    signal(SIGWINCH, _pass_on_signal);
+
+    int32_t status;
+    if (!_read_all(conn, &status, sizeof(status)))
+        return 1;
+
+    if (WIFSIGNALED(status))
+        return 128 + WTERMSIG(status);
+    return WEXITSTATUS(status);
+}
+
+#endif
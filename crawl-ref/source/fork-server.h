@@ -0,0 +1,21 @@
+/**
+ * @file
+ * @brief Starting games by forking a process that has already loaded the
+ *        game data.
+**/
+
+#pragma once
+
+#ifdef USE_FORK_SERVER
+
+// Load the shared game data, then fork a game for each client that connects
+// to socket_path. Only returns in a forked game, with argc and argv replaced
+// by that game's command line and its client's environment and stdio in place.
+void run_fork_server(const string &socket_path, int &argc, char **&argv);
+
+// Ask the fork server at socket_path to start a game with this process's
+// stdio, environment and command line (less the leading -fork-client and
+// socket_path), and wait for it. Returns the game's exit code.
+int fork_client(const char *socket_path, int argc, char **argv);
+
+#endif
@@ -63,6 +63,7 @@
 #include "tags.h"
 #include "throw.h"
 #include "travel.h"
+#include "turn-profile.h"
 #include "unwind.h"
 #include "version.h"
 #include "viewchar.h"
@@ -1577,6 +1578,7 @@ static const char* config_defaults[] =
 void read_init_file(bool runscript)
 {
     Options.reset_options();
+    clear_autopickup_cache();
 
     // Load Lua builtins.
 #ifdef CLUA_BINDINGS
@@ -2473,6 +2475,9 @@ void game_options::read_option_line(const string &str, bool runscript)
     if (first_equals < 0)
         return;
 
+    // Any option might change an item's name or which patterns it matches.
+    clear_autopickup_cache();
+
     field = str.substr(first_equals + 1);
     field = expand_vars(field);
 
@@ -3831,6 +3836,12 @@ enum commandline_option_type
     CLO_NO_THROTTLE,
     CLO_PLAYABLE_JSON, // JSON metadata for species, jobs, combos.
     CLO_EDIT_BONES,
+    CLO_PROFILE_TURNS,
+    CLO_BENCH_LEVELGEN,
+#ifdef USE_FORK_SERVER
+    CLO_FORK_SERVER,
+    CLO_FORK_CLIENT,
+#endif
 #ifdef USE_TILE_WEB
     CLO_WEBTILES_SOCKET,
     CLO_AWAIT_CONNECTION,
@@ -3849,7 +3860,10 @@ static const char *cmd_ops[] =
     "extra-opt-first", "extra-opt-last", "sprint-map", "edit-save",
     "print-charset", "tutorial", "wizard", "explore", "no-save", "gdb",
     "no-gdb", "nogdb", "throttle", "no-throttle", "playable-json",
-    "bones",
+    "bones", "profile-turns", "bench-levelgen",
+#ifdef USE_FORK_SERVER
+    "fork-server", "fork-client",
+#endif
 #ifdef USE_TILE_WEB
     "webtiles-socket", "await-connection", "print-webtiles-options",
 #endif
@@ -4672,9 +4686,15 @@ bool parse_args(int argc, char **argv, bool rc_only)
 
         case CLO_MAPSTAT:
         case CLO_OBJSTAT:
+        case CLO_BENCH_LEVELGEN:
 #ifdef DEBUG_STATISTICS
             if (o == CLO_MAPSTAT)
                 crawl_state.map_stat_gen = true;
+            else if (o == CLO_BENCH_LEVELGEN)
+            {
+                crawl_state.map_stat_gen = true;
+                crawl_state.level_gen_bench = true;
+            }
             else
                 crawl_state.obj_stat_gen = true;
 #ifdef USE_TILE_LOCAL
@@ -4903,6 +4923,32 @@ bool parse_args(int argc, char **argv, bool rc_only)
             _edit_bones(argc - current - 1, argv + current + 1);
             end(0);
 
+        case CLO_PROFILE_TURNS:
+#ifdef TURN_PROFILER
+            if (!next_is_param)
+                end(1, false, "File name required for -%s\n", arg);
+            if (!rc_only && !profile_turns_to(next_arg))
+                end(1, true, "Couldn't open turn profile %s", next_arg);
+            nextUsed = true;
+#else
+            end(1, false, "Turn profiling is not enabled in this build.\n");
+#endif
+            break;
+
+#ifdef USE_FORK_SERVER
+        case CLO_FORK_SERVER:
+            if (!next_is_param)
+                return false;
+
+            SysEnv.fork_server_socket = next_arg;
+            nextUsed = true;
+            break;
+
+        case CLO_FORK_CLIENT:
+            // Handled in main() before anything else, if it comes first.
+            end(1, false, "-%s must be the first option.\n", arg);
+#endif
+
         case CLO_SEED:
             if (!next_is_param)
             {
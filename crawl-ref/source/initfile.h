@@ -63,6 +63,10 @@ public:
     vector<string> extra_opts_first;
     vector<string> extra_opts_last;
 
+#ifdef USE_FORK_SERVER
+    string fork_server_socket;
+#endif
+
 public:
     void add_rcdir(const string &dir);
 };
@@ -0,0 +1,43 @@
+/**
+ * @file
+ * @brief Contiguous per-cell lists of the items in each floor pile.
+**/
+
+#include "AppHdr.h"
+
+#include "item-piles.h"
+
+#include "env.h"
+
+item_pile_index::item_pile_index()
+{
+    generations.init(0);
+    stale_cells.init(true);
+}
+
+void item_pile_index::clear()
+{
+    for (int x = 0; x < GXM; ++x)
+        for (int y = 0; y < GYM; ++y)
+            generations[x][y]++;
+    stale_cells.init(true);
+}
+
+void item_pile_index::touch(const coord_def &p)
+{
+    generations(p)++;
+    stale_cells.set(p);
+}
+
+const vector<int> &item_pile_index::pile(const coord_def &p)
+{
+    vector<int> &items = piles(p);
+    if (stale_cells(p))
+    {
+        items.clear();
+        for (int i = igrd(p); i != NON_ITEM; i = mitm[i].link)
+            items.push_back(i);
+        stale_cells.set(p, false);
+    }
+    return items;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file
+ * @brief Contiguous per-cell lists of the items in each floor pile.
+**/
+
+#pragma once
+
+#include <vector>
+
+#include "bitary.h"
+#include "fixedarray.h"
+
+/**
+ * A mirror of the floor item chains (igrd and item_def::link) as a list of
+ * item indices per cell, top of the pile first.
+ *
+ * Following a chain means waiting on each item before the next one can be
+ * found, and a pile's items are scattered all over mitm[]. With the indices
+ * of a pile in one place, stack_iterator can fetch its items without those
+ * dependent loads, which makes walking large piles several times faster
+ * once they have dropped out of the cache.
+ *
+ * The chains stay authoritative: they are what gets saved, and what the
+ * floor item code in items.cc edits. Anything that edits a chain calls
+ * touch() on its cell, which marks the cell's list as stale and bumps the
+ * cell's generation; the next pile() call walks the chain to rebuild it.
+ * stack_iterator compares generations to notice a pile changing under it,
+ * and follows links from then on, as it always used to.
+ */
+class item_pile_index
+{
+public:
+    item_pile_index();
+
+    // Mark every cell as stale, for when the chains are rebuilt wholesale.
+    void clear();
+    void touch(const coord_def &p);
+
+    // The items at p, top first, as the chain from igrd(p) lists them.
+    const vector<int> &pile(const coord_def &p);
+
+    unsigned int generation(const coord_def &p) const
+    {
+        return generations(p);
+    }
+
+    // Whether p's list waits to be rebuilt by the next pile() call.
+    bool stale(const coord_def &p) const { return stale_cells(p); }
+
+private:
+    FixedArray<vector<int>, GXM, GYM> piles;
+    FixedArray<unsigned int, GXM, GYM> generations;
+    FixedBitArray<GXM, GYM> stale_cells;
+};
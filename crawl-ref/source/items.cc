@@ -14,6 +14,7 @@
 #include <cstring>
 #include <functional> // mem_fn
 #include <limits>
+#include <unordered_map>
 
 #include "adjust.h"
 #include "areas.h"
@@ -41,6 +42,7 @@
 #include "god-passive.h"
 #include "god-prayer.h"
 #include "god-wrath.h"
+#include "hash.h"
 #include "hints.h"
 #include "hints.h"
 #include "hiscores.h"
@@ -162,6 +164,7 @@ void link_items()
 {
     // First, initialise igrd array.
     igrd.init(NON_ITEM);
+    env.item_piles.clear();
 
     // Link all items on the grid, plus shop inventory,
     // but DON'T link the huge pile of monster items at (-2,-2).
@@ -205,6 +208,7 @@ void link_items()
             mitm[i].link = mitm[movable_ind].link;
             mitm[movable_ind].link = i;
         }
+        env.item_piles.touch(mitm[i].pos);
     }
 }
 
@@ -306,15 +310,22 @@ static int _cull_items()
 
 /*---------------------------------------------------------------------*/
 stack_iterator::stack_iterator(const coord_def& pos, bool accessible)
+    : pile(nullptr), pile_pos(0), cell(pos), pile_generation(0)
 {
     cur_link = accessible ? you.visible_igrd(pos) : igrd(pos);
-    if (cur_link != NON_ITEM)
-        next_link = mitm[cur_link].link;
-    else
+    if (cur_link == NON_ITEM)
+    {
         next_link = NON_ITEM;
+        return;
+    }
+
+    pile = &env.item_piles.pile(pos);
+    pile_generation = env.item_piles.generation(pos);
+    next_link = pile->size() > 1 ? (*pile)[1] : NON_ITEM;
 }
 
 stack_iterator::stack_iterator(int start_link)
+    : pile(nullptr), pile_pos(0), cell(), pile_generation(0)
 {
     cur_link = start_link;
     if (cur_link != NON_ITEM)
@@ -348,8 +359,21 @@ int stack_iterator::index() const
 const stack_iterator& stack_iterator::operator ++ ()
 {
     cur_link = next_link;
-    if (cur_link != NON_ITEM)
+    if (cur_link == NON_ITEM)
+        return *this;
+
+    if (pile && env.item_piles.generation(cell) == pile_generation)
+    {
+        ++pile_pos;
+        next_link = pile_pos + 1 < pile->size() ? (*pile)[pile_pos + 1]
+                                                : NON_ITEM;
+    }
+    else
+    {
+        // Someone changed the pile; carry on along the links from here.
+        pile = nullptr;
         next_link = mitm[cur_link].link;
+    }
     return *this;
 }
 
@@ -489,12 +513,64 @@ void inc_mitm_item_quantity(int obj, int amount)
     mitm[obj].quantity += amount;
 }
 
+// Slots of mitm[] that may be free, so that finding one doesn't mean walking
+// over every item on the level. Slots freed through init_item() or
+// destroy_item() are marked here; marks on slots that have been filled since
+// are dropped when get_mitm_slot() comes across them, and any item zeroed
+// behind our backs is still found by a full scan once the marks run out.
+#define ITEM_SLOT_WORDS ((MAX_ITEMS + 63) / 64)
+static uint64_t free_item_slots[ITEM_SLOT_WORDS];
+
+static void _mark_item_slot(int item, bool free)
+{
+    ASSERT_RANGE(item, 0, MAX_ITEMS);
+    const uint64_t bit = uint64_t(1) << (item % 64);
+    if (free)
+        free_item_slots[item / 64] |= bit;
+    else
+        free_item_slots[item / 64] &= ~bit;
+}
+
+// Mark every currently unused slot; for when mitm[] is replaced wholesale.
+void reset_free_item_slots()
+{
+    for (int i = 0; i < MAX_ITEMS; ++i)
+        _mark_item_slot(i, !mitm[i].defined());
+}
+
+// The lowest free slot below limit, or limit if there is none.
+static int _find_free_item_slot(int limit)
+{
+    for (int w = 0; w < ITEM_SLOT_WORDS && w * 64 < limit; ++w)
+    {
+        if (!free_item_slots[w])
+            continue;
+
+        for (int i = w * 64; i < min(limit, (w + 1) * 64); ++i)
+        {
+            if (!(free_item_slots[w] & (uint64_t(1) << (i % 64))))
+                continue;
+            if (!mitm[i].defined())
+                return i;
+            // Reused without going through get_mitm_slot().
+            _mark_item_slot(i, false);
+        }
+    }
+
+    for (int i = 0; i < limit; i++)
+        if (!mitm[i].defined())
+            return i;
+
+    return limit;
+}
+
 void init_item(int item)
 {
     if (item == NON_ITEM)
         return;
 
     mitm[item].clear();
+    _mark_item_slot(item, true);
 }
 
 // Returns an unused mitm slot, or NON_ITEM if none available.
@@ -507,11 +583,7 @@ int get_mitm_slot(int reserve)
     if (crawl_state.game_is_arena())
         reserve = 0;
 
-    int item = NON_ITEM;
-
-    for (item = 0; item < (MAX_ITEMS - reserve); item++)
-        if (!mitm[item].defined())
-            break;
+    int item = _find_free_item_slot(MAX_ITEMS - reserve);
 
     if (item >= MAX_ITEMS - reserve)
     {
@@ -533,6 +605,7 @@ int get_mitm_slot(int reserve)
     ASSERT(item != NON_ITEM);
 
     init_item(item);
+    _mark_item_slot(item, false);
 
     return item;
 }
@@ -591,6 +664,7 @@ void unlink_item(int dest)
         {
             // link igrd to the second item
             igrd(mitm[dest].pos) = mitm[dest].link;
+            env.item_piles.touch(mitm[dest].pos);
 
             mitm[dest].pos.reset();
             mitm[dest].link = NON_ITEM;
@@ -605,6 +679,7 @@ void unlink_item(int dest)
             {
                 // unlink dest
                 si->link = mitm[dest].link;
+                env.item_piles.touch(mitm[dest].pos);
                 mitm[dest].pos.reset();
                 mitm[dest].link = NON_ITEM;
                 return;
@@ -626,11 +701,13 @@ void unlink_item(int dest)
     int  old_link = mitm[dest].link; // used to try linking the first
 
     // Clean the relevant parts of the object.
+    env.item_piles.clear();
     mitm[dest].base_type = OBJ_UNASSIGNED;
     mitm[dest].quantity  = 0;
     mitm[dest].link      = NON_ITEM;
     mitm[dest].pos.reset();
     mitm[dest].props.clear();
+    _mark_item_slot(dest, true);
 
     // Look through all items for links to this item.
     for (auto &item : mitm)
@@ -681,7 +758,10 @@ void destroy_item(item_def &item, bool never_created)
             set_unique_item_status(item, UNIQ_NOT_EXISTS);
     }
 
+    const int slot = &item - mitm.buffer();
     item.clear();
+    if (slot >= 0 && slot < MAX_ITEMS)
+        _mark_item_slot(slot, true);
 }
 
 void destroy_item(int dest, bool never_created)
@@ -725,10 +805,11 @@ void lose_item_stack(const coord_def& where)
         if (si ->defined()) // FIXME is this check necessary?
         {
             item_was_lost(*si);
-            si->clear();
+            init_item(si.index());
         }
     }
     igrd(where) = NON_ITEM;
+    env.item_piles.touch(where);
 }
 
 /**
@@ -2343,6 +2424,7 @@ bool move_item_to_grid(int *const obj, const coord_def& p, bool silent)
         item.link = igrd(p);
         igrd(p) = ob;
     }
+    env.item_piles.touch(p);
 
     if (item_is_orb(item))
         env.orb_pos = p;
@@ -2382,6 +2464,8 @@ void move_item_stack_to_grid(const coord_def& from, const coord_def& to)
 
     igrd(to) = igrd(from);
     igrd(from) = NON_ITEM;
+    env.item_piles.touch(from);
+    env.item_piles.touch(to);
 }
 
 // Returns false if no items could be dropped.
@@ -2902,10 +2986,89 @@ static int _autopickup_subtype(const item_def &item)
     }
 }
 
-static bool _is_option_autopickup(const item_def &item, bool ignore_force)
+struct autopickup_verdict
 {
-    string iname = _autopickup_item_name(item);
+    string name;          ///< what _autopickup_item_name() gave
+    maybe_bool matched;   ///< the first matching autopickup option, if any
+};
+
+// Autopickup names and their verdicts from the autopickup options, keyed on
+// everything in an item that goes into the name. The prefixes also depend on
+// the player, so the entries are dropped whenever _autopickup_player_state()
+// changes, as well as when the options are reloaded.
+static unordered_map<string, autopickup_verdict> autopickup_verdicts;
+static uint32_t autopickup_verdict_state = 0;
 
+// Don't let a long game of corpses and stacks grow this without bound.
+#define MAX_AUTOPICKUP_VERDICTS 2000
+
+void clear_autopickup_cache()
+{
+    autopickup_verdicts.clear();
+}
+
+/// A hash of the player state that item_prefix() and the item annotations
+/// look at for items we're willing to cache.
+static uint32_t _autopickup_player_state()
+{
+    const int scalars[] =
+    {
+        you.species, you.char_class, static_cast<int>(you.form), you.religion, you.piety,
+        you.hunger_state, you.experience_level, you.where_are_you,
+        you.num_turns == 0,
+    };
+    uint32_t state = hash32(scalars, sizeof(scalars));
+    state = state * 31 + hash32(&you.mutation[0], NUM_MUTATIONS);
+    state = state * 31 + hash32(&you.equip[0], NUM_EQUIP);
+    state = state * 31 + hash32(&you.skills[0], NUM_SKILLS);
+    state = state * 31 + hash32(&you.spells[0],
+                                MAX_KNOWN_SPELLS * sizeof(spell_type));
+    return state;
+}
+
+/// Does the player's Lua annotate items for searches, and thus autopickup?
+static bool _autopickup_annotate_hook_exists()
+{
+#ifdef CLUA_BINDINGS
+    lua_stack_cleaner clean(clua);
+    clua.pushglobal(STASH_LUA_SEARCH_ANNOTATE);
+    return !lua_isnil(clua, -1);
+#else
+    return false;
+#endif
+}
+
+/// The cache key for an item's autopickup name, or "" if it can't be cached.
+static string _autopickup_verdict_key(const item_def &item)
+{
+    // Artefact and named corpse names live in props, as does the damnation
+    // bolt hack, and whether a book is useless depends on the whole spell
+    // library.
+    if (is_artefact(item) || item.base_type == OBJ_BOOKS
+        || item.props.exists(CORPSE_NAME_KEY)
+        || item.props.exists(DAMNATION_BOLT_KEY))
+    {
+        return "";
+    }
+
+    // The Lua annotation can look at anything at all.
+    if (_autopickup_annotate_hook_exists())
+        return "";
+
+    const int fields[] =
+    {
+        item.base_type, item.sub_type, item.plus, item.plus2, item.special,
+        item.quantity, item.orig_monnum, item_type_known(item),
+        is_shop_item(item),
+    };
+    string key(reinterpret_cast<const char *>(fields), sizeof(fields));
+    key.append(reinterpret_cast<const char *>(&item.flags), sizeof(item.flags));
+    key += item.inscription;
+    return key;
+}
+
+static bool _is_option_autopickup(const item_def &item, bool ignore_force)
+{
     if (item.base_type < NUM_OBJECT_CLASSES)
     {
         const int force = you.force_autopickup[item.base_type][_autopickup_subtype(item)];
@@ -2915,6 +3078,42 @@ static bool _is_option_autopickup(const item_def &item, bool ignore_force)
     else
         return false;
 
+    const string key = _autopickup_verdict_key(item);
+    if (!key.empty())
+    {
+        const uint32_t state = _autopickup_player_state();
+        if (state != autopickup_verdict_state
+            || autopickup_verdicts.size() >= MAX_AUTOPICKUP_VERDICTS)
+        {
+            autopickup_verdicts.clear();
+            autopickup_verdict_state = state;
+        }
+    }
+
+    // Copied out rather than referenced, since the Lua hooks could find
+    // their way back here and clear the cache.
+    string iname;
+    maybe_bool matched = MB_MAYBE;
+    auto cached = key.empty() ? autopickup_verdicts.end()
+                              : autopickup_verdicts.find(key);
+    if (cached != autopickup_verdicts.end())
+    {
+        iname = cached->second.name;
+        matched = cached->second.matched;
+    }
+    else
+    {
+        iname = _autopickup_item_name(item);
+        for (const pair<text_pattern, bool>& option : Options.force_autopickup)
+            if (option.first.matches(iname))
+            {
+                matched = option.second ? MB_TRUE : MB_FALSE;
+                break;
+            }
+        if (!key.empty())
+            autopickup_verdicts[key] = { iname, matched };
+    }
+
 #ifdef CLUA_BINDINGS
     maybe_bool res = clua.callmaybefn("ch_force_autopickup", "is",
                                       &item, iname.c_str());
@@ -2932,9 +3131,8 @@ static bool _is_option_autopickup(const item_def &item, bool ignore_force)
 #endif
 
     // Check for initial settings
-    for (const pair<text_pattern, bool>& option : Options.force_autopickup)
-        if (option.first.matches(iname))
-            return option.second;
+    if (matched != MB_MAYBE)
+        return matched == MB_TRUE;
 
     return Options.autopickups[item.base_type];
 }
@@ -4500,6 +4698,8 @@ void move_items(const coord_def r, const coord_def p)
     // Move entire stack over to p.
     igrd(p) = igrd(r);
     igrd(r) = NON_ITEM;
+    env.item_piles.touch(r);
+    env.item_piles.touch(p);
 }
 
 // erase everything the player doesn't know
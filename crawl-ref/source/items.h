@@ -63,6 +63,7 @@ item_def *find_floor_item(object_class_type cls, int sub_type = -1);
 int item_on_floor(const item_def &item, const coord_def& where);
 
 void init_item(int item);
+void reset_free_item_slots();
 
 void add_held_books_to_library();
 
@@ -130,6 +131,7 @@ bool origin_is_acquirement(const item_def& item,
                            item_source_type *type = nullptr);
 
 bool item_needs_autopickup(const item_def &, bool ignore_force = false);
+void clear_autopickup_cache();
 bool can_autopickup();
 
 bool need_to_autopickup();
@@ -179,6 +181,13 @@ public:
 private:
     int cur_link;
     int next_link;
+
+    // While the pile at cell keeps the generation it started with, the rest
+    // of it is read from its list in env.item_piles instead of the links.
+    const vector<int> *pile;
+    size_t pile_pos;
+    coord_def cell;
+    unsigned int pile_generation;
 };
 
 class mon_inv_iterator : public iterator<forward_iterator_tag, item_def>
@@ -831,6 +831,14 @@ static int dgn_remove_listener(lua_State *ls)
     return 0;
 }
 
+static int dgn_schedule_wakeup(lua_State *ls)
+{
+    MAPMARKER(ls, 1, mark);
+    map_lua_marker *listener = dynamic_cast<map_lua_marker*>(mark);
+    dungeon_events.schedule_wakeup(listener, luaL_checkint(ls, 2));
+    return 0;
+}
+
 static int dgn_remove_marker(lua_State *ls)
 {
     MAPMARKER(ls, 1, mark);
@@ -1800,6 +1808,7 @@ const struct luaL_reg dgn_dlib[] =
 { "load_des_file", dgn_load_des_file },
 { "register_listener", dgn_register_listener },
 { "remove_listener", dgn_remove_listener },
+{ "schedule_wakeup", dgn_schedule_wakeup },
 { "remove_marker", dgn_remove_marker },
 { "num_matching_markers", dgn_num_matching_markers },
 { "get_floor_colour", dgn_get_floor_colour },
@@ -778,8 +778,22 @@ void cprintf(const char *format, ...)
     }
 }
 
+// What puttext() last drew, so that cells which haven't changed since needn't
+// be written again. Anything else that draws over the map, or clears the
+// screen, means the whole view has to be drawn afresh.
+struct drawn_cell
+{
+    char32_t glyph;
+    unsigned short colour;
+};
+static vector<drawn_cell> last_view;
+static coord_def last_view_pos;
+
 void putwch(char32_t chr)
 {
+    if (get_cursor_region() == GOTO_DNGN)
+        last_view.clear();
+
     wchar_t c = chr;
     if (!c)
         c = ' ';
@@ -798,15 +812,35 @@ void puttext(int x1, int y1, const crawl_view_buffer &vbuf)
 {
     const screen_cell_t *cell = vbuf;
     const coord_def size = vbuf.size();
+    const size_t ncells = size.x * size.y;
+    const bool redraw_all = last_view.size() != ncells
+                            || last_view_pos != coord_def(x1, y1);
+    if (redraw_all)
+        last_view.resize(ncells);
+
+    drawn_cell *last = last_view.data();
     for (int y = 0; y < size.y; ++y)
     {
-        cgotoxy(x1, y1 + y);
+        bool positioned = false;
         for (int x = 0; x < size.x; ++x)
         {
-            put_colour_ch(cell->colour, cell->glyph);
+            if (redraw_all
+                || cell->glyph != last->glyph || cell->colour != last->colour)
+            {
+                if (!positioned)
+                    cgotoxy(x1 + x, y1 + y);
+                put_colour_ch(cell->colour, cell->glyph);
+                last->glyph = cell->glyph;
+                last->colour = cell->colour;
+                positioned = true;
+            }
+            else
+                positioned = false;
             cell++;
+            last++;
         }
     }
+    last_view_pos = coord_def(x1, y1);
     update_screen();
 }
 
@@ -858,6 +892,7 @@ int num_to_lines(int num)
 
 void clrscr()
 {
+    last_view.clear();
     textcolour(LIGHTGREY);
     textbackground(BLACK);
     clear();
@@ -74,6 +74,7 @@
 #include "files.h"
 #include "fineff.h"
 #include "food.h"
+#include "fork-server.h"
 #include "fprop.h"
 #include "god-abil.h"
 #include "god-companions.h"
@@ -154,6 +155,7 @@
 #include "transform.h"
 #include "traps.h"
 #include "travel.h"
+#include "turn-profile.h"
 #include "uncancel.h"
 #include "version.h"
 #include "viewchar.h"
@@ -188,6 +190,9 @@ void world_reacts();
 
 static key_recorder repeat_again_rec;
 
+// Whether the view was updated at the end of the last turn.
+static bool _view_current = false;
+
 // Clockwise, around the compass from north (same order as run_dir_type)
 const struct coord_def Compass[9] =
 {
@@ -233,6 +238,25 @@ static void _startup_asserts()
         ASSERT(branches[i].id == i || branches[i].id == NUM_BRANCHES);
 }
 
+static void _init_locale()
+{
+#ifndef __ANDROID__
+# ifdef DGAMELAUNCH
+    // avoid commas instead of dots, etc, on CDO
+    setlocale(LC_CTYPE, "");
+# else
+    setlocale(LC_ALL, "");
+# endif
+#endif
+#ifdef USE_TILE_WEB
+    if (strcasecmp(nl_langinfo(CODESET), "UTF-8"))
+    {
+        fprintf(stderr, "Webtiles require an UTF-8 locale.\n");
+        exit(1);
+    }
+#endif
+}
+
 //
 //  It all starts here. Some initialisations are run first, then straight
 //  to new_game and then input.
@@ -248,21 +272,16 @@ __attribute__((externally_visible))
 #endif
 int main(int argc, char *argv[])
 {
-#ifndef __ANDROID__
-# ifdef DGAMELAUNCH
-    // avoid commas instead of dots, etc, on CDO
-    setlocale(LC_CTYPE, "");
-# else
-    setlocale(LC_ALL, "");
-# endif
-#endif
-#ifdef USE_TILE_WEB
-    if (strcasecmp(nl_langinfo(CODESET), "UTF-8"))
+#ifdef USE_FORK_SERVER
+    // Hand everything else to a fork server, without loading anything here.
+    if (argc > 2 && (!strcmp(argv[1], "-fork-client")
+                     || !strcmp(argv[1], "--fork-client")))
     {
-        fprintf(stderr, "Webtiles require an UTF-8 locale.\n");
-        exit(1);
+        return fork_client(argv[2], argc, argv);
     }
 #endif
+
+    _init_locale();
 #ifdef DEBUG_GLOBALS
     real_Options = new game_options();
     real_you = new player();
@@ -303,6 +322,26 @@ int main(int argc, char *argv[])
     // make sure all the expected data directories exist
     validate_basedirs();
 
+#ifdef USE_FORK_SERVER
+    if (!SysEnv.fork_server_socket.empty())
+    {
+        // Only returns in a process forked for a new game, with that game's
+        // command line, environment and stdio in place. Start over from
+        // there, skipping the data the server has already loaded.
+        run_fork_server(SysEnv.fork_server_socket, argc, argv);
+
+        _init_locale();
+        get_system_environment();
+        init_signals();
+        if (!parse_args(argc, argv, true))
+        {
+            _show_commandline_options_help();
+            return 1;
+        }
+        validate_basedirs();
+    }
+#endif
+
     // Read the init file.
     read_init_file();
 
@@ -548,6 +587,11 @@ static void _show_commandline_options_help()
          "iterations");
     puts("  -force-map <map>    For -mapstat and -objstat, alway choose the "
          "      given map on every level.");
+    puts("  -bench-levelgen [<levels>] time level generation by builder "
+         "stage, and");
+    puts("      report vetoes and the slowest vaults; same level syntax and "
+         "-iters");
+    puts("      as -mapstat. Iteration n is built with seed <seed>+n.");
 #endif
     puts("");
     puts("Miscellaneous options:");
@@ -556,6 +600,16 @@ static void _show_commandline_options_help()
     puts("  -gdb/-no-gdb     produce gdb backtrace when a crash happens (default:on)");
 #endif
     puts("  -playable-json   list playable species, jobs, and character combos.");
+#ifdef TURN_PROFILER
+    puts("  -profile-turns <file>  write a per-turn timing breakdown to <file>");
+#endif
+#ifdef USE_FORK_SERVER
+    puts("  -fork-server <socket>  load game data, then start a game for each");
+    puts("      -fork-client connecting to <socket>, by forking; only the");
+    puts("      server's own user may connect");
+    puts("  -fork-client <socket> <options>  start a game with <options> via");
+    puts("      the fork server at <socket>; must be the first option");
+#endif
 
 #if defined(TARGET_OS_WINDOWS) && defined(USE_TILE_LOCAL)
     text_popup(help, L"Dungeon Crawl command line help");
@@ -2064,7 +2118,12 @@ static void _prep_input()
     you.redraw_status_lights = true;
     print_stats();
 
-    viewwindow();
+    // The turn that just ended has already brought what the player knows up
+    // to date, and nothing has happened since; if the view isn't being drawn
+    // anyway, don't redo the LOS work for every turn of a long rest.
+    if (!_view_current || !view_drawing_suppressed())
+        viewwindow();
+    _view_current = false;
     maybe_update_stashes();
     if (check_for_interesting_features() && you.running.is_explore())
         stop_running();
@@ -2194,7 +2253,7 @@ static void _update_still_winds()
     end_still_winds();
 }
 
-void world_reacts()
+static void _world_reacts()
 {
     // All markers should be activated at this point.
     ASSERT(!env.markers.need_activate());
@@ -2279,6 +2338,7 @@ void world_reacts()
     wu_jian_end_of_turn_effects();
 
     viewwindow();
+    _view_current = true;
 
     if (you.cannot_act() && any_messages()
         && crawl_state.repeat_cmd != CMD_WIZARD)
@@ -2322,6 +2382,15 @@ void world_reacts()
     you.los_noise_level = 0;
 }
 
+void world_reacts()
+{
+    {
+        PROFILE_SECTION(PROF_WORLD_REACTS);
+        _world_reacts();
+    }
+    profile_end_turn();
+}
+
 static command_type _get_next_cmd()
 {
 #ifdef DGL_SIMPLE_MESSAGING
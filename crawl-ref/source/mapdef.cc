@@ -2401,6 +2401,18 @@ void map_def::strip()
     feat_renames.clear();
 }
 
+// Compile the map's Lua before it goes into the des cache, so that each
+// time the map is reloaded from there it needn't be parsed again.
+void map_def::precompile_lua()
+{
+    prelude.precompile(dlua);
+    mapchunk.precompile(dlua);
+    main.precompile(dlua);
+    validate.precompile(dlua);
+    veto.precompile(dlua);
+    epilogue.precompile(dlua);
+}
+
 void map_def::load()
 {
     if (!index_only)
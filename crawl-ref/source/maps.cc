@@ -1350,6 +1350,7 @@ static void _write_map_prelude(const string &filebase, time_t mtime)
     marshallUByte(outf, TAG_MINOR_VERSION);
     marshallByte(outf, WORD_LEN);
     marshallSigned(outf, mtime);
+    lc_global_prelude.precompile(dlua);
     lc_global_prelude.write(outf);
     fclose(fp);
 }
@@ -1368,7 +1369,10 @@ static void _write_map_full(const string &filebase, size_t vs, size_t ve,
     marshallByte(outf, WORD_LEN);
     marshallSigned(outf, mtime);
     for (size_t i = vs; i < ve; ++i)
+    {
+        vdefs[i].precompile_lua();
         vdefs[i].write_full(outf);
+    }
     fclose(fp);
 }
 
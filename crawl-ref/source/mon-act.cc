@@ -69,6 +69,7 @@
 #include "throw.h"
 #include "timed-effects.h"
 #include "traps.h"
+#include "turn-profile.h"
 #include "viewchar.h"
 #include "view.h"
 
@@ -2359,6 +2360,8 @@ static void _display_just_seen()
  */
 void handle_monsters(bool with_noise)
 {
+    PROFILE_SECTION(PROF_HANDLE_MONSTERS);
+
     for (monster_iterator mi; mi; ++mi)
     {
         _pre_monster_move(**mi);
@@ -963,6 +963,18 @@ static bool _mons_check_foe(monster* mon, const coord_def& p,
            || mon->has_ench(ENCH_INSANE) && p == you.pos();
 }
 
+// Does the search for the nearest foe around center reach a before b?
+// The search goes out ring by ring, and along each ring by x, then y.
+static bool _foe_search_before(const coord_def &center, const coord_def &a,
+                               const coord_def &b)
+{
+    const coord_def da = a - center;
+    const coord_def db = b - center;
+    if (da.rdist() != db.rdist())
+        return da.rdist() < db.rdist();
+    return da.x != db.x ? da.x < db.x : da.y < db.y;
+}
+
 // Choose random nearest monster as a foe.
 void set_nearest_monster_foe(monster* mon, bool near_player)
 {
@@ -983,23 +995,45 @@ void set_nearest_monster_foe(monster* mon, bool near_player)
 
     while (true)
     {
-        for (int k = 1; k <= LOS_RADIUS; ++k)
+        // Only cells with an actor in them can hold a foe, so rather than
+        // checking every cell in rings around the center, look up the nearby
+        // actors and put them in the order the rings would have visited them:
+        // by distance, then by x offset, then by y offset.
+        vector<coord_def> actor_pos;
+        if ((you.pos() - center).rdist() <= LOS_RADIUS)
+            actor_pos.push_back(you.pos());
+        for (monster_iterator mi(center, LOS_RADIUS); mi; ++mi)
+            actor_pos.push_back(mi->pos());
+        sort(actor_pos.begin(), actor_pos.end(),
+             [center](const coord_def &a, const coord_def &b)
+             {
+                 return _foe_search_before(center, a, b);
+             });
+        actor_pos.erase(unique(actor_pos.begin(), actor_pos.end()),
+                        actor_pos.end());
+
+        vector<coord_def> monster_pos;
+        for (const coord_def &p : actor_pos)
         {
-            vector<coord_def> monster_pos;
-            for (int i = -k; i <= k; ++i)
-                for (int j = -k; j <= k; (abs(i) == k ? j++ : j += 2*k))
-                {
-                    const coord_def p = center + coord_def(i, j);
+            // Don't look past the nearest ring with a foe in it.
+            if (!monster_pos.empty()
+                && (p - center).rdist() > (monster_pos[0] - center).rdist())
+            {
+                break;
+            }
 
-                    if (near_player && !you.see_cell(p))
-                        continue;
+            if (p == center)
+                continue;
 
-                    if (_mons_check_foe(mon, p, friendly, neutral, second_pass))
-                        monster_pos.push_back(p);
-                }
-            if (monster_pos.empty())
+            if (near_player && !you.see_cell(p))
                 continue;
 
+            if (_mons_check_foe(mon, p, friendly, neutral, second_pass))
+                monster_pos.push_back(p);
+        }
+
+        if (!monster_pos.empty())
+        {
             const coord_def mpos = monster_pos[random2(monster_pos.size())];
             if (mpos == you.pos())
                 mon->foe = MHITYOU;
@@ -7845,11 +7845,11 @@ static bool _ms_waste_of_time(monster* mon, mon_spell_slot slot)
             || grid_distance(mon->pos(), foe->pos()) > 2;
 
     case SPELL_INJURY_BOND:
-        for (monster_iterator mi; mi; ++mi)
+        for (monster_near_iterator mi(mon->pos(), LOS_NO_TRANS); mi; ++mi)
         {
             if (mons_aligned(mon, *mi) && !mi->has_ench(ENCH_CHARM)
                 && !mi->has_ench(ENCH_HEXED)
-                && *mi != mon && mon->see_cell_no_trans(mi->pos())
+                && *mi != mon
                 && !mi->has_ench(ENCH_INJURY_BOND))
             {
                 return false; // We found at least one target; that's enough.
@@ -0,0 +1,146 @@
+/**
+ * @file
+ * @brief Compact index over the occupied slots of menv.
+**/
+
+#include "AppHdr.h"
+
+#include "mon-index.h"
+
+#include <cstring>
+
+#include "coord.h"
+
+// The index of the lowest set bit of a nonzero word.
+static int _lowest_bit(uint64_t word)
+{
+    int bit = 0;
+    while (!(word & 1))
+    {
+        word >>= 1;
+        bit++;
+    }
+    return bit;
+}
+
+monster_index::monster_index()
+{
+    clear();
+}
+
+void monster_index::clear()
+{
+    memset(used_bits, 0, sizeof(used_bits));
+    memset(buckets, 0, sizeof(buckets));
+    for (coord_def &p : positions)
+        p.reset();
+    num_used = 0;
+}
+
+void monster_index::set_bucket(const coord_def &p, int mindex, bool value)
+{
+    if (!map_bounds(p))
+        return;
+
+    const uint64_t bit = uint64_t(1) << (mindex % WORD_BITS);
+    uint64_t &word =
+        buckets[p.x / BUCKET_SIZE][p.y / BUCKET_SIZE][mindex / WORD_BITS];
+    if (value)
+        word |= bit;
+    else
+        word &= ~bit;
+}
+
+void monster_index::occupy(int mindex)
+{
+    ASSERT_RANGE(mindex, 0, MAX_MONSTERS);
+    const uint64_t bit = uint64_t(1) << (mindex % WORD_BITS);
+    uint64_t &word = used_bits[mindex / WORD_BITS];
+    if (!(word & bit))
+    {
+        word |= bit;
+        num_used++;
+    }
+}
+
+void monster_index::vacate(int mindex)
+{
+    ASSERT_RANGE(mindex, 0, MAX_MONSTERS);
+    const uint64_t bit = uint64_t(1) << (mindex % WORD_BITS);
+    uint64_t &word = used_bits[mindex / WORD_BITS];
+    if (word & bit)
+    {
+        word &= ~bit;
+        num_used--;
+    }
+    set_bucket(positions[mindex], mindex, false);
+    positions[mindex].reset();
+}
+
+void monster_index::set_pos(int mindex, const coord_def &p)
+{
+    ASSERT_RANGE(mindex, 0, MAX_MONSTERS);
+    set_bucket(positions[mindex], mindex, false);
+    positions[mindex] = p;
+    set_bucket(p, mindex, true);
+}
+
+bool monster_index::used(int mindex) const
+{
+    ASSERT_RANGE(mindex, 0, MAX_MONSTERS);
+    return used_bits[mindex / WORD_BITS] & (uint64_t(1) << (mindex % WORD_BITS));
+}
+
+int monster_index::next(int mindex) const
+{
+    int i = mindex + 1;
+    while (i < MAX_MONSTERS)
+    {
+        // Shift away the slots before i in this word.
+        const uint64_t word = used_bits[i / WORD_BITS] >> (i % WORD_BITS);
+        if (!word)
+        {
+            // Nothing left in this word; skip straight to the next one.
+            i = (i / WORD_BITS + 1) * WORD_BITS;
+            continue;
+        }
+
+        i += _lowest_bit(word);
+        return i < MAX_MONSTERS ? i : MAX_MONSTERS;
+    }
+    return MAX_MONSTERS;
+}
+
+int monster_index::next_near(int mindex, const coord_def &c, int radius) const
+{
+    if (radius < 0)
+        return next(mindex);
+
+    const int bx1 = max(c.x - radius, 0) / BUCKET_SIZE;
+    const int by1 = max(c.y - radius, 0) / BUCKET_SIZE;
+    const int bx2 = min(c.x + radius, GXM - 1) / BUCKET_SIZE;
+    const int by2 = min(c.y + radius, GYM - 1) / BUCKET_SIZE;
+    if (bx1 > bx2 || by1 > by2)
+        return MAX_MONSTERS;
+
+    int i = mindex + 1;
+    while (i < MAX_MONSTERS)
+    {
+        const int w = i / WORD_BITS;
+        uint64_t word = 0;
+        for (int bx = bx1; bx <= bx2; ++bx)
+            for (int by = by1; by <= by2; ++by)
+                word |= buckets[bx][by][w];
+        word = (word & used_bits[w]) >> (i % WORD_BITS);
+
+        if (!word)
+        {
+            i = (w + 1) * WORD_BITS;
+            continue;
+        }
+
+        i += _lowest_bit(word);
+        return i < MAX_MONSTERS ? i : MAX_MONSTERS;
+    }
+    return MAX_MONSTERS;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file
+ * @brief Compact index over the occupied slots of menv.
+**/
+
+#pragma once
+
+/**
+ * A small, cache-friendly mirror of the parts of menv that are needed to
+ * decide whether a slot is worth looking at: which slots are in use, and
+ * where their monsters stand.
+ *
+ * The monster objects themselves are large (props, enchantments, inventory,
+ * ghost, travel path...), so striding over all MAX_MONSTERS of them to find
+ * the live ones pulls a lot of memory through the cache every turn. The
+ * iterators in act-iter.h use this index to skip empty slots a word at a time
+ * and to reject out-of-range monsters by position without touching them.
+ *
+ * Slots are also filed into a coarse grid of BUCKET_SIZE square buckets by
+ * position, so that queries around a point only need to look at the slots in
+ * the few buckets that overlap the area of interest. Queries still return
+ * slots in menv order, so switching a loop over to them doesn't change the
+ * order monsters are visited in.
+ *
+ * The index is kept up to date by the monster lifecycle: get_free_monster()
+ * and level loading mark slots as used, monster::reset() frees them, and
+ * monster::set_position() records movement. A slot may be marked used while
+ * its monster is not (yet) alive; consumers must still check alive().
+ */
+class monster_index
+{
+public:
+    monster_index();
+
+    void clear();
+
+    void occupy(int mindex);
+    void vacate(int mindex);
+    void set_pos(int mindex, const coord_def &p);
+
+    bool used(int mindex) const;
+    const coord_def &pos(int mindex) const { return positions[mindex]; }
+
+    // The first used slot after mindex (pass -1 to start from the
+    // beginning), or MAX_MONSTERS if there are none.
+    int next(int mindex) const;
+
+    // As next(), but only considering slots whose monsters might be within
+    // radius (in grid_distance) of c. This may return slots slightly out of
+    // range; check pos() for an exact answer.
+    int next_near(int mindex, const coord_def &c, int radius) const;
+
+    int count() const { return num_used; }
+
+private:
+    static const int WORD_BITS = 64;
+    static const int NUM_WORDS = (MAX_MONSTERS + WORD_BITS - 1) / WORD_BITS;
+
+    static const int BUCKET_SIZE = 8;
+    static const int BUCKETS_X = (GXM + BUCKET_SIZE - 1) / BUCKET_SIZE;
+    static const int BUCKETS_Y = (GYM + BUCKET_SIZE - 1) / BUCKET_SIZE;
+
+    typedef uint64_t slot_mask[NUM_WORDS];
+
+    void set_bucket(const coord_def &p, int mindex, bool value);
+
+    slot_mask used_bits;
+    slot_mask buckets[BUCKETS_X][BUCKETS_Y];
+    coord_def positions[MAX_MONSTERS];
+    int num_used;
+};
@@ -824,14 +824,10 @@ static bool _herd_wander_target(monster * mon)
 
     int dist_thresh = LOS_DEFAULT_RANGE + HERD_COMFORT_RANGE;
 
-    for (monster_iterator mit; mit; ++mit)
+    for (monster_iterator mit(mon->pos(), dist_thresh); mit; ++mit)
     {
-        if (*mit == mon
-            || mons_genus(mit->type) != mons_genus(mon->type)
-            || grid_distance(mit->pos(), mon->pos()) > dist_thresh)
-        {
+        if (*mit == mon || mons_genus(mit->type) != mons_genus(mon->type))
             continue;
-        }
 
         friends.push_back(mit);
     }
@@ -835,6 +835,7 @@ monster* get_free_monster()
         if (mons.type == MONS_NO_MONSTER)
         {
             mons.reset();
+            env.mons_index.occupy(mons.mindex());
             return &mons;
         }
 
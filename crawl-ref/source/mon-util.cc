@@ -74,6 +74,14 @@
 
 static FixedVector < int, NUM_MONSTERS > mon_entry;
 
+// Per-class properties checked for every monster every turn, copied out of
+// mondata[] by init_monsters() so that each lookup is a single load from a
+// small array indexed directly by monster type.
+static FixedVector < monclass_flags_t, NUM_MONSTERS > mon_class_flags;
+static FixedVector < resists_t, NUM_MONSTERS > mon_class_resists;
+static FixedVector < mon_holy_type, NUM_MONSTERS > mon_class_holy;
+static FixedVector < int8_t, NUM_MONSTERS > mon_class_speed;
+
 struct mon_display
 {
     char32_t glyph;
@@ -95,13 +103,14 @@ static vector<monster_type> species_by_habitat[NUM_HABITATS];
 #define MONDATASIZE ARRAYSZ(mondata)
 
 static int _mons_exp_mod(monster_type mclass);
+static resists_t _mons_class_resists(monster_type mc);
 
 // Macro that saves some typing, nothing more.
 #define smc get_monster_data(mc)
 // ASSERT(smc) was getting really old
 #define ASSERT_smc()                                                    \
     do {                                                                \
-        if (!get_monster_data(mc))                                      \
+        if (mc < 0 || mc >= NUM_MONSTERS)                               \
             die("bogus mc (no monster data): %s (%d)",                  \
                 mons_type_name(mc, DESC_PLAIN).c_str(), mc);            \
     } while (false)
@@ -268,6 +277,16 @@ void init_monsters()
         if (entry == -1)
             entry = mon_entry[MONS_PROGRAM_BUG];
 
+    for (int i = 0; i < NUM_MONSTERS; ++i)
+    {
+        const monster_type mc = static_cast<monster_type>(i);
+        const monsterentry &me = mondata[mon_entry[i]];
+        mon_class_flags[i] = me.bitfields;
+        mon_class_holy[i] = me.holiness;
+        mon_class_speed[i] = me.speed;
+        mon_class_resists[i] = _mons_class_resists(mc);
+    }
+
     init_monster_symbols();
 }
 
@@ -361,7 +380,7 @@ static resists_t _beast_facet_resists(beast_facet facet)
     return lookup(resists, facet, 0);
 }
 
-resists_t get_mons_class_resists(monster_type mc)
+static resists_t _mons_class_resists(monster_type mc)
 {
     const monsterentry *me = get_monster_data(mc);
     const resists_t resists = me ? me->resists
@@ -376,6 +395,13 @@ resists_t get_mons_class_resists(monster_type mc)
     return _apply_holiness_resists(resists, mons_class_holiness(mc));
 }
 
+resists_t get_mons_class_resists(monster_type mc)
+{
+    if (mc >= 0 && mc < NUM_MONSTERS)
+        return mon_class_resists[mc];
+    return _mons_class_resists(mc);
+}
+
 resists_t get_mons_resists(const monster& m)
 {
     const monster& mon = get_tentacle_head(m);
@@ -437,8 +463,7 @@ monster* monster_at(const coord_def &pos)
 /// Are any of the bits set?
 bool mons_class_flag(monster_type mc, monclass_flags_t bits)
 {
-    const monsterentry * const me = get_monster_data(mc);
-    return me && (me->bitfields & bits);
+    return mc >= 0 && mc < NUM_MONSTERS && (mon_class_flags[mc] & bits);
 }
 
 int monster::wearing(equipment_type slot, int sub_type, bool calc_unid) const
@@ -685,7 +710,7 @@ string holiness_description(mon_holy_type holiness)
 mon_holy_type mons_class_holiness(monster_type mc)
 {
     ASSERT_smc();
-    return smc->holiness;
+    return mon_class_holy[mc];
 }
 
 bool mons_class_is_stationary(monster_type mc)
@@ -3279,7 +3304,7 @@ static int _mons_exp_mod(monster_type mc)
 int mons_class_base_speed(monster_type mc)
 {
     ASSERT_smc();
-    return smc->speed;
+    return mon_class_speed[mc];
 }
 
 mon_energy_usage mons_class_energy(monster_type mc)
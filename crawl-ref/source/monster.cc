@@ -99,6 +99,14 @@ monster::~monster()
 {
 }
 
+// The menv slot this monster lives in, or -1 for monsters outside menv (anon
+// monsters and the dummies used for descriptions and the like).
+static int _menv_slot(const monster &mons)
+{
+    const int i = mons.mindex();
+    return invalid_monster_index(i) ? -1 : i;
+}
+
 monster::monster(const monster& mon)
 {
     constricting = 0;
@@ -146,6 +154,9 @@ void monster::reset()
     mons_remove_from_grid(*this);
     target.reset();
     position.reset();
+    const int slot = _menv_slot(*this);
+    if (slot >= 0)
+        env.mons_index.vacate(slot);
     firing_pos.reset();
     patrol_point.reset();
     travel_target = MTRAV_NONE;
@@ -206,6 +217,13 @@ void monster::init_with(const monster& mon)
         ghost.reset(new ghost_demon(*mon.ghost));
     else
         ghost.reset(nullptr);
+
+    const int slot = _menv_slot(*this);
+    if (slot >= 0 && type != MONS_NO_MONSTER)
+    {
+        env.mons_index.occupy(slot);
+        env.mons_index.set_pos(slot, position);
+    }
 }
 
 uint32_t monster::last_client_id = 0;
@@ -2683,6 +2701,17 @@ void monster::set_hit_dice(int new_hit_dice)
     }
 }
 
+void monster::set_position(const coord_def &c)
+{
+    // Keep the index current before the LOS and area hooks run, in case they
+    // look for nearby monsters.
+    const int slot = _menv_slot(*this);
+    if (slot >= 0)
+        env.mons_index.set_pos(slot, c);
+
+    actor::set_position(c);
+}
+
 void monster::moveto(const coord_def& c, bool clear_net)
 {
     if (clear_net && c != pos() && in_bounds(pos()))
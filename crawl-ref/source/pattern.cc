@@ -13,6 +13,7 @@
     #include <regex.h>
 #endif
 
+#include "libutil.h"
 #include "pattern.h"
 #include "stringutil.h"
 
@@ -171,21 +172,195 @@ bool text_pattern::operator== (const text_pattern &tp) const
     return pattern == tp.pattern && ignore_case == tp.ignore_case;
 }
 
+// Escaped letters that stand alone, without an argument following them.
+#ifdef REGEX_PCRE
+static const char *_plain_escapes = "dDwWsSbBAzZGhHvVRXntrfea";
+#else
+static const char *_plain_escapes = "wWsSbB";
+#endif
+
+/**
+ * Find the longest run of literal text that must appear in anything the
+ * given regex matches.
+ *
+ * Only the simple cases common in options files are understood: anything
+ * unusual just ends the current run (or gives up entirely), so the result
+ * never claims text is required when it isn't.
+ *
+ * @return the required text, or "" if none was found.
+ */
+static string _required_text(const string &pattern)
+{
+    // Inline flags could make the pattern case-insensitive.
+    if (pattern.find("(?") != string::npos)
+        return "";
+
+    string best, run;
+    auto end_run = [&]()
+    {
+        if (run.length() > best.length())
+            best = run;
+        run.clear();
+    };
+
+    // Nothing inside a group counts, since the group might be optional.
+    int depth = 0;
+    const size_t len = pattern.length();
+    for (size_t i = 0; i < len; ++i)
+    {
+        const unsigned char c = pattern[i];
+        switch (c)
+        {
+        case '*':
+        case '?':
+        case '{':
+            // The preceding character was optional.
+            if (!run.empty())
+                run.pop_back();
+            end_run();
+            if (c == '{')
+            {
+                i = pattern.find('}', i);
+                if (i == string::npos)
+                    return "";
+            }
+            break;
+
+        case '(':
+            end_run();
+            ++depth;
+            break;
+
+        case ')':
+            end_run();
+            --depth;
+            break;
+
+        case '|':
+            // Alternatives within a group don't matter, since groups are
+            // ignored anyway; at the top level, nothing is required.
+            if (!depth)
+                return "";
+            end_run();
+            break;
+
+        case '[':
+            end_run();
+            ++i;
+            if (i < len && pattern[i] == '^')
+                ++i;
+            if (i < len && pattern[i] == ']')
+                ++i;
+            for (; i < len && pattern[i] != ']'; ++i)
+            {
+#ifdef REGEX_PCRE
+                // POSIX takes backslashes in brackets literally.
+                if (pattern[i] == '\\')
+                    ++i;
+                else
+#endif
+                if (pattern[i] == '[' && i + 1 < len
+                    && strchr(":.=", pattern[i + 1]))
+                {
+                    // [:alpha:] and friends
+                    i = pattern.find(string(1, pattern[i + 1]) + "]", i + 2);
+                    if (i == string::npos)
+                        return "";
+                    ++i;
+                }
+            }
+            if (i >= len)
+                return "";
+            break;
+
+        case '\\':
+            if (++i >= len)
+                return "";
+            if (isadigit(pattern[i]))
+            {
+                // A backreference or octal code, perhaps of several digits.
+                end_run();
+                while (i + 1 < len && isadigit(pattern[i + 1]))
+                    ++i;
+            }
+            else if (isaalpha(pattern[i]))
+            {
+                // Classes and assertions that take no argument just end the
+                // run. Anything else (\p{..}, \cX, \x.., \Q..\E, ...) has
+                // an argument of its own; give up rather than parse it.
+                if (!strchr(_plain_escapes, pattern[i]))
+                    return "";
+                end_run();
+            }
+#ifndef REGEX_PCRE
+            // GNU word boundaries and buffer anchors.
+            else if (strchr("<>`'", pattern[i]))
+                end_run();
+#endif
+            else if (pattern[i] & 0x80)
+                return "";
+            else if (!depth)
+                run += pattern[i];
+            break;
+
+        case '.':
+        case '^':
+        case '$':
+        case '+': // The preceding character is still required, at least once.
+            end_run();
+            break;
+
+        default:
+            // Leave multibyte characters alone; quantifiers might apply to
+            // the whole character.
+            if (depth || (c & 0x80))
+                end_run();
+            else
+                run += c;
+            break;
+        }
+    }
+    end_run();
+    return best;
+}
+
+static bool _ascii_iequal(char a, char b)
+{
+    return toalower(a) == toalower(b);
+}
+
 bool text_pattern::compile() const
 {
-    return !empty()?
-        !!(compiled_pattern = _compile_pattern(pattern.c_str(), ignore_case))
-      : false;
+    if (empty())
+        return false;
+
+    required_text = _required_text(pattern);
+    return !!(compiled_pattern = _compile_pattern(pattern.c_str(),
+                                                  ignore_case));
+}
+
+// Could the pattern match this text? Much cheaper than running the regex.
+bool text_pattern::might_match(const char *s, int length) const
+{
+    if (required_text.empty())
+        return true;
+
+    const char *end = s + length;
+    return ignore_case
+        ? search(s, end, required_text.begin(), required_text.end(),
+                 _ascii_iequal) != end
+        : search(s, end, required_text.begin(), required_text.end()) != end;
 }
 
 bool text_pattern::matches(const char *s, int length) const
 {
-    return valid() && _pattern_match(compiled_pattern, s, length);
+    return valid() && might_match(s, length)
+           && _pattern_match(compiled_pattern, s, length);
 }
 
 pattern_match text_pattern::match_location(const char *s, int length) const
 {
-    if (valid())
+    if (valid() && might_match(s, length))
         return _pattern_match_location(compiled_pattern, s, length);
     else
         return pattern_match::failed(string(s));
@@ -117,8 +117,13 @@ public:
     }
 
 private:
+    bool might_match(const char *s, int length) const;
+
     string pattern;
     mutable void *compiled_pattern;
+    // Text every match must contain, letting most non-matches skip the
+    // regex engine. Set by compile().
+    mutable string required_text;
     mutable bool isvalid;
     bool ignore_case;
 };
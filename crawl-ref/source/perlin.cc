@@ -435,13 +435,16 @@ namespace perlin
         double xi = x;
         double yi = y;
         double zi = z;
+        // The same rotation every octave; no need to redo the trig.
+        static const double rot_sin = sin(1.41421356);
+        static const double rot_cos = cos(1.41421356);
         for (uint32_t octave = 0; octave < octaves; ++octave)
         {
             value += noise(xi / divisor, yi / divisor, zi / divisor) / divisor;
             norm += 1 / divisor;
             divisor *= 2;
-            double xt = yi * sin(1.41421356) + cos(1.41421356);
-            yi = yi * cos(1.41421356) + sin(1.41421356);
+            double xt = yi * rot_sin + rot_cos;
+            yi = yi * rot_cos + rot_sin;
             xi = xt;
             zi += 1.7;
         }
@@ -35,6 +35,7 @@
 #include "state.h"
 #include "stringutil.h"
 #include "terrain.h"
+#include "turn-profile.h"
 #include "view.h"
 #include "viewchar.h"
 
@@ -764,6 +765,8 @@ void yell(const actor* mon)
 
 void apply_noises()
 {
+    PROFILE_SECTION(PROF_NOISES);
+
     // [ds] This copying isn't awesome, but we cannot otherwise handle
     // the case where one set of noises wakes up monsters who then let
     // out yips of their own, modifying _noise_grid while it is in the
@@ -849,11 +852,8 @@ bool fake_noisy(int loudness, const coord_def& where)
 
 void check_monsters_sense(sense_type sense, int range, const coord_def& where)
 {
-    for (monster_iterator mi; mi; ++mi)
+    for (monster_iterator mi(where, range); mi; ++mi)
     {
-        if (grid_distance(mi->pos(), where) > range)
-            continue;
-
         switch (sense)
         {
         case SENSE_SMELL_BLOOD:
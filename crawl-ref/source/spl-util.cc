@@ -80,9 +80,16 @@ struct spell_desc
 
 static int spell_list[NUM_SPELLS];
 
+// The most frequently queried fields of spelldata[], copied out by
+// init_spell_descs() into arrays indexed directly by spell type.
+static spell_flags spell_flag_list[NUM_SPELLS];
+static spschools_type spell_school_list[NUM_SPELLS];
+static int8_t spell_level_list[NUM_SPELLS];
+
 #define SPELLDATASIZE ARRAYSZ(spelldata)
 
 static const struct spell_desc *_seekspell(spell_type spellid);
+static spell_type _checkspell(spell_type spellid);
 
 //
 //             BEGIN PUBLIC FUNCTIONS
@@ -118,6 +125,9 @@ void init_spell_descs()
                 "spell '%s' is declared as a monster spell but is a player spell", data.title);
 
         spell_list[data.id] = i;
+        spell_flag_list[data.id] = data.flags;
+        spell_school_list[data.id] = data.disciplines;
+        spell_level_list[data.id] = data.level;
     }
 }
 
@@ -434,7 +444,7 @@ bool spell_is_direct_explosion(spell_type spell)
 
 bool spell_harms_target(spell_type spell)
 {
-    const spell_flags flags = _seekspell(spell)->flags;
+    const spell_flags flags = get_spell_flags(spell);
 
     if (flags & (spflag::helpful | spflag::neutral))
         return false;
@@ -447,7 +457,7 @@ bool spell_harms_target(spell_type spell)
 
 bool spell_harms_area(spell_type spell)
 {
-    const spell_flags flags = _seekspell(spell)->flags;
+    const spell_flags flags = get_spell_flags(spell);
 
     if (flags & (spflag::helpful | spflag::neutral))
         return false;
@@ -462,14 +472,14 @@ bool spell_harms_area(spell_type spell)
 // for Xom acting (more power = more likely to grab his attention) {dlb}
 int spell_mana(spell_type which_spell)
 {
-    return _seekspell(which_spell)->level;
+    return spell_level_list[_checkspell(which_spell)];
 }
 
 // applied in naughties (more difficult = higher level knowledge = worse)
 // and triggers for Sif acting (same reasoning as above, just good) {dlb}
 int spell_difficulty(spell_type which_spell)
 {
-    return _seekspell(which_spell)->level;
+    return spell_level_list[_checkspell(which_spell)];
 }
 
 int spell_levels_required(spell_type which_spell)
@@ -493,7 +503,7 @@ int spell_levels_required(spell_type which_spell)
 
 spell_flags get_spell_flags(spell_type which_spell)
 {
-    return _seekspell(which_spell)->flags;
+    return spell_flag_list[_checkspell(which_spell)];
 }
 
 const char *get_spell_target_prompt(spell_type which_spell)
@@ -525,7 +535,7 @@ bool spell_typematch(spell_type which_spell, spschool which_disc)
 //jmf: next two for simple bit handling
 spschools_type get_spell_disciplines(spell_type spell)
 {
-    return _seekspell(spell)->disciplines;
+    return spell_school_list[_checkspell(spell)];
 }
 
 int count_bits(uint64_t bits)
@@ -902,11 +912,15 @@ spschool skill2spell_type(skill_type spell_skill)
 //jmf: Simplified; moved init code to top function, init_spell_descs().
 static const spell_desc *_seekspell(spell_type spell)
 {
-    ASSERT_RANGE(spell, 0, NUM_SPELLS);
-    const int index = spell_list[spell];
-    ASSERT(index != -1);
+    return &spelldata[spell_list[_checkspell(spell)]];
+}
 
-    return &spelldata[index];
+// Check that a spell has data, for lookups in the flattened tables.
+static spell_type _checkspell(spell_type spell)
+{
+    ASSERT_RANGE(spell, 0, NUM_SPELLS);
+    ASSERT(spell_list[spell] != -1);
+    return spell;
 }
 
 bool is_valid_spell(spell_type spell)
@@ -16,6 +16,11 @@
 
 #ifdef USE_SQLITE_DBM
 
+// Larger than any of the text databases, so each is mapped whole.
+#define DB_MMAP_SIZE "67108864"
+// Negative cache sizes are in KiB rather than pages.
+#define DB_PRIVATE_CACHE_KIB "-64"
+
 class sqlite_retry_iterator
 {
 public:
@@ -123,6 +128,21 @@ From SQLite's documentation:
     }
 
     init_schema();
+
+#ifndef ANCIENT_SQLITE
+    // Read-only databases (the text databases) are the same file for every
+    // game running on a server. Read them through a memory map, so their
+    // pages are shared via the page cache, and keep only a token private
+    // page cache instead of SQLite's default of about 2MB per connection.
+    if (readonly)
+    {
+        sqlite3_exec(db, "PRAGMA mmap_size=" DB_MMAP_SIZE ";",
+                     nullptr, nullptr, nullptr);
+        sqlite3_exec(db, "PRAGMA cache_size=" DB_PRIVATE_CACHE_KIB ";",
+                     nullptr, nullptr, nullptr);
+    }
+#endif
+
     return errc;
 }
 
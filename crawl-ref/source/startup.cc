@@ -77,8 +77,25 @@ static void _loading_message(string m)
 #endif
 }
 
+// Set when a fork server has loaded the shared data, for the first game
+// forked from it.
+static bool _data_preloaded = false;
+
+static void _load_databases()
+{
+    // Initialise internal databases.
+    _loading_message("Loading databases...");
+    databaseSystemInit();
+
+    _loading_message("Loading spells and features...");
+    init_feat_desc_cache();
+    init_spell_name_cache();
+    init_spell_rarities();
+}
+
 // Initialise a whole lot of stuff...
-static void _initialize()
+// If data_only, stop once the maps, dungeon Lua and databases are loaded.
+static void _initialize(bool data_only = false)
 {
     Options.fixup_options();
 
@@ -113,6 +130,7 @@ static void _initialize()
     init_anon();
 
     igrd.init(NON_ITEM);
+    env.item_piles.clear();
     mgrd.init(NON_MONSTER);
     env.map_knowledge.init(map_cell());
     env.pgrid.init(terrain_property_t{});
@@ -120,34 +138,43 @@ static void _initialize()
     you.unique_creatures.reset();
     you.unique_items.init(UNIQ_NOT_EXISTS);
 
-    // Set up the Lua interpreter for the dungeon builder.
-    init_dungeon_lua();
+    if (_data_preloaded)
+    {
+        // Forked from a fork server, which loaded all this before it knew
+        // this game's options. Maps and dungeon Lua don't depend on them,
+        // but the databases may need a translation, and this process
+        // shouldn't be sharing the server's connections in any case.
+        _data_preloaded = false;
+        databaseSystemShutdown();
+        _load_databases();
+    }
+    else
+    {
+        // Set up the Lua interpreter for the dungeon builder.
+        init_dungeon_lua();
 
 #ifdef USE_TILE_LOCAL
-    // Draw the splash screen before the database gets initialised as that
-    // may take awhile and it's better if the player can look at a pretty
-    // screen while this happens.
-    if (!crawl_state.tiles_disabled && crawl_state.title_screen)
-        loading_screen_open();
+        // Draw the splash screen before the database gets initialised as
+        // that may take awhile and it's better if the player can look at a
+        // pretty screen while this happens.
+        if (!crawl_state.tiles_disabled && crawl_state.title_screen)
+            loading_screen_open();
 #endif
 
-    // Initialise internal databases.
-    _loading_message("Loading databases...");
-    databaseSystemInit();
+        _load_databases();
 
-    _loading_message("Loading spells and features...");
-    init_feat_desc_cache();
-    init_spell_name_cache();
-    init_spell_rarities();
-
-    // Read special levels and vaults.
-    _loading_message("Loading maps...");
-    read_maps();
-    run_map_global_preludes();
+        // Read special levels and vaults.
+        _loading_message("Loading maps...");
+        read_maps();
+        run_map_global_preludes();
+    }
 
     if (crawl_state.build_db)
         end(0);
 
+    if (data_only)
+        return;
+
 #ifdef USE_TILE_LOCAL
     if (!crawl_state.tiles_disabled && crawl_state.title_screen)
         loading_screen_close();
@@ -1292,6 +1319,18 @@ static bool _exit_type_allows_menu_bypass(game_exit exit)
 }
 #endif
 
+#ifdef USE_FORK_SERVER
+/**
+ * Load the maps, dungeon Lua and databases without starting a game, so that
+ * games forked from this process start with them already in memory.
+ */
+void preload_game_data()
+{
+    _initialize(true);
+    _data_preloaded = true;
+}
+#endif
+
 bool startup_step()
 {
     _initialize();
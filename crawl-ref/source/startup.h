@@ -7,3 +7,6 @@
 
 bool startup_step();
 void cio_init();
+#ifdef USE_FORK_SERVER
+void preload_game_data();
+#endif
@@ -1131,6 +1131,17 @@ void StashTracker::write(FILE *f, bool identify) const
     }
 }
 
+vector<level_id> StashTracker::known_levels() const
+{
+    vector<level_id> levs;
+    for (const auto &entry : levels)
+        levs.push_back(entry.first);
+    return levs;
+}
+
+// Writes the list of levels with stashes; each level's stashes are written
+// separately by save_level(), so that levels which haven't changed needn't
+// be saved again.
 void StashTracker::save(writer& outf) const
 {
     // Time of last corpse update.
@@ -1139,12 +1150,22 @@ void StashTracker::save(writer& outf) const
     // How many levels have we?
     marshallShort(outf, (short) levels.size());
 
-    // And ask each level to write itself to the tag
     for (const auto &entry : levels)
-        entry.second.save(outf);
+        entry.first.save(outf);
 }
 
-void StashTracker::load(reader& inf)
+void StashTracker::save_level(writer& outf, const level_id &lev) const
+{
+    levels.at(lev).save(outf);
+}
+
+/**
+ * Read the list of levels with stashes.
+ *
+ * @return the levels whose stashes must then be read with load_level().
+ *         Older saves keep the levels inline, and load them here.
+ */
+vector<level_id> StashTracker::load(reader& inf)
 {
     // Time of last corpse update.
     last_corpse_update = unmarshallInt(inf);
@@ -1152,13 +1173,29 @@ void StashTracker::load(reader& inf)
     int count = unmarshallShort(inf);
 
     levels.clear();
+    vector<level_id> to_load;
     for (int i = 0; i < count; ++i)
     {
-        LevelStashes st;
-        st.load(inf);
-        if (st.has_stashes())
-            levels[st.where()] = st;
+#if TAG_MAJOR_VERSION == 34
+        if (inf.getMinorVersion() < TAG_MINOR_LEVEL_CHUNKS)
+        {
+            load_level(inf);
+            continue;
+        }
+#endif
+        level_id lev;
+        lev.load(inf);
+        to_load.push_back(lev);
     }
+    return to_load;
+}
+
+void StashTracker::load_level(reader& inf)
+{
+    LevelStashes st;
+    st.load(inf);
+    if (st.has_stashes())
+        levels[st.where()] = st;
 }
 
 void StashTracker::update_visible_stashes()
@@ -251,8 +251,11 @@ public:
 
     void  add_stash(coord_def p);
 
+    vector<level_id> known_levels() const;
     void save(writer&) const;
-    void load(reader&);
+    void save_level(writer&, const level_id &lev) const;
+    vector<level_id> load(reader&);
+    void load_level(reader&);
 
     void write(FILE *f, bool identify = false) const;
 
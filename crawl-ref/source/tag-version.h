@@ -230,6 +230,7 @@ enum tag_minor_version
     TAG_MINOR_REMOVE_DECKS,        // Decks are no more
     TAG_MINOR_GAMESEEDS,           // Game seeds + rng state saved
     TAG_MINOR_YELLOW_DRACONIAN_RACID, // Change yellow draconians' rAcid fake mutation to a true mutation.
+    TAG_MINOR_LEVEL_CHUNKS,        // Travel cache and stashes saved per level.
 #endif
     NUM_TAG_MINORS,
     TAG_MINOR_VERSION = NUM_TAG_MINORS - 1
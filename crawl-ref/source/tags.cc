@@ -1212,6 +1212,7 @@ static void _shunt_monsters_out_of_walls()
                          m.pos().x, m.pos().y);
                     env.mgrid(m.pos()) = NON_MONSTER;
                     m.position = *di;
+                    env.mons_index.set_pos(i, *di);
                     env.mgrid(*di) = i;
                     break;
                 }
@@ -6054,6 +6055,8 @@ static void tag_read_level_items(reader &th)
         }
     }
 #endif
+
+    reset_free_item_slots();
 }
 
 void unmarshallMonster(reader &th, monster& m)
@@ -6560,6 +6563,8 @@ static void tag_read_level_monsters(reader &th)
     {
         monster& m = menv[i];
         unmarshallMonster(th, m);
+        if (m.type != MONS_NO_MONSTER)
+            env.mons_index.occupy(i);
 
         // place monster
         if (!m.alive())
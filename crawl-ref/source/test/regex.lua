@@ -0,0 +1,28 @@
+-- Test that the literal-text prefilter on regexes never rejects text that
+-- the regex itself matches, and still lets non-matches through to fail.
+
+local function check(pat, text, expected)
+  if expected == nil then
+    expected = true
+  end
+  assert(crawl.regex(pat):matches(text) == expected,
+         "regex '" .. pat .. "' " .. (expected and "should" or "shouldn't")
+         .. " match '" .. text .. "'")
+end
+
+check("foo\\.bar", "a foo.bar b")
+check("foo\\.bar", "a fooxbar b", false)
+check("\\bword\\b", "a word here")
+check("a\\wbcd", "axbcd")
+check("a\\wbcd", "axbce", false)
+
+-- PCRE-only syntax; POSIX regex builds don't have \d.
+if crawl.regex("\\d"):matches("1") then
+  check("\\p{Lu}x", "Ax")
+  check("\\cZfoo", string.char(26) .. "foo")
+  check("(a)\\g{-1}xy", "aaxy")
+  check("\\d{2}abc", "12abc")
+  check("\\d{2}abc", "12ab", false)
+  check("\\x{41}bc", "Abc")
+  check("\\Qa.b\\E", "a.b")
+end
@@ -530,6 +530,16 @@ void TilesFramework::send_dump_info(const string& type, const string& filename)
     finish_message();
 }
 
+// Sent to the server for its log, not to clients.
+void TilesFramework::send_profile_report(const string& report)
+{
+    write_message("*");
+    write_message("{\"msg\":\"profile\",\"report\":\"");
+    write_message_escaped(report);
+    write_message("\"}");
+    finish_message();
+}
+
 void TilesFramework::_send_version()
 {
 #ifdef WEB_DIR_PATH
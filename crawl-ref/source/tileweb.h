@@ -142,6 +142,7 @@ public:
 
     void send_exit_reason(const string& type, const string& message = "");
     void send_dump_info(const string& type, const string& filename);
+    void send_profile_report(const string& report);
 
     string get_message();
     void write_message(PRINTF(1, ));
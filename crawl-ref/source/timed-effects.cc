@@ -611,13 +611,20 @@ static void _catchup_monster_move(monster* mon, int moves)
 {
     coord_def pos(mon->pos());
 
+    // Nothing about the monster changes until it's shifted at the end, so
+    // work out its habitat and direction once rather than every step.
+    const monster_type habitat_type = fixup_zombie_type(mon->type,
+                                                        mons_base_type(*mon));
+    const bool flies = mon->airborne();
+    const bool retreating = mons_is_retreating(*mon);
+
     // Dirt simple movement.
     for (int i = 0; i < moves; ++i)
     {
         coord_def inc(mon->target - pos);
         inc = coord_def(sgn(inc.x), sgn(inc.y));
 
-        if (mons_is_retreating(*mon))
+        if (retreating)
             inc *= -1;
 
         // Bounds check: don't let shifting monsters try to run off the
@@ -635,7 +642,8 @@ static void _catchup_monster_move(monster* mon, int moves)
         const dungeon_feature_type feat = grd(next);
         if (feat_is_solid(feat)
             || monster_at(next)
-            || !monster_habitable_grid(mon, feat))
+            || !monster_habitable_grid(habitat_type, feat, DNGN_UNSEEN,
+                                       flies))
         {
             break;
         }
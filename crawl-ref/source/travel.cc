@@ -511,6 +511,120 @@ static bool _is_safe_move(const coord_def& c)
     return _is_safe_cloud(c);
 }
 
+// Travel floods outwards from the destination until it reaches the player, so
+// each step of a long trip floods nearly the same area as the step before.
+// The last such flood is recorded here: every cell it reached, in the order
+// it first reached them, with the cell it was reached from and the state of
+// the cell as the flood saw it. A later step to the same destination can be
+// read off the record, provided every cell the flood reached before the
+// player's new position is unchanged.
+struct travel_step_record
+{
+    bool valid;
+    level_id level;
+    coord_def start;
+    vector<transporter_info> transporters;
+    FixedArray<int, GXM, GYM> touch_index;
+    vector<coord_def> touched;
+    vector<coord_def> touched_from;
+    vector<uint8_t> touched_state;
+
+    travel_step_record() : valid(false) { }
+};
+
+static travel_step_record _travel_steps;
+
+// Everything about c that a travel flood (not explore, not a fallback) reads.
+static uint8_t _travel_cell_state(const coord_def &c)
+{
+    const dungeon_feature_type feat = env.map_knowledge(c).feat();
+    return (_is_travelsafe_square(c) ? 1 : 0)
+           | _feature_traverse_cost(feat) << 1
+           | (is_excluded(c) && feat == DNGN_TRANSPORTER ? 1 : 0) << 3
+           | (grd(c) == DNGN_TRANSPORTER_LANDING ? 1 : 0) << 4;
+}
+
+static vector<transporter_info> _current_transporters()
+{
+    LevelInfo *li = travel_cache.find_level_info(level_id::current());
+    return li ? li->get_transporters() : vector<transporter_info>();
+}
+
+static bool _same_transporters(const vector<transporter_info> &a,
+                               const vector<transporter_info> &b)
+{
+    if (a.size() != b.size())
+        return false;
+
+    for (unsigned int i = 0; i < a.size(); ++i)
+    {
+        if (a[i].position != b[i].position
+            || a[i].destination != b[i].destination)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void _note_travel_touch(const coord_def &from, const coord_def &c)
+{
+    int &index = _travel_steps.touch_index(c);
+    if (index >= 0)
+        return;
+
+    index = _travel_steps.touched.size();
+    _travel_steps.touched.push_back(c);
+    _travel_steps.touched_from.push_back(from);
+    _travel_steps.touched_state.push_back(_travel_cell_state(c));
+}
+
+static void _start_travel_record(const coord_def &start)
+{
+    _travel_steps.valid = true;
+    _travel_steps.level = level_id::current();
+    _travel_steps.start = start;
+    _travel_steps.transporters = _current_transporters();
+    _travel_steps.touch_index.init(-1);
+    _travel_steps.touched.clear();
+    _travel_steps.touched_from.clear();
+    _travel_steps.touched_state.clear();
+    _note_travel_touch(start, start);
+}
+
+// If the last recorded travel flood from start would still reach dest first
+// from the same cell, return that cell; otherwise, the origin.
+static coord_def _recorded_travel_step(const coord_def &start,
+                                       const coord_def &dest)
+{
+    if (!_travel_steps.valid
+        || _travel_steps.start != start
+        || _travel_steps.level != level_id::current())
+    {
+        return coord_def();
+    }
+
+    const int index = _travel_steps.touch_index(dest);
+    if (index <= 0
+        || !_same_transporters(_travel_steps.transporters,
+                               _current_transporters()))
+    {
+        return coord_def();
+    }
+
+    // dest itself is never examined, so its own state doesn't matter.
+    for (int i = 0; i < index; ++i)
+    {
+        if (_travel_cell_state(_travel_steps.touched[i])
+            != _travel_steps.touched_state[i])
+        {
+            return coord_def();
+        }
+    }
+
+    return _travel_steps.touched_from[index];
+}
+
 void travel_init_load_level()
 {
     curr_excludes.clear();
@@ -1073,7 +1187,8 @@ travel_pathfind::travel_pathfind()
       unexplored_place(), greedy_place(), unexplored_dist(0), greedy_dist(0),
       refdist(nullptr), reseed_points(), features(nullptr), unreachables(),
       point_distance(travel_point_distance), points(0), next_iter_points(0),
-      traveled_distance(0), circ_index(0)
+      traveled_distance(0), circ_index(0), try_fallback(false),
+      reuse_steps(false), record_steps(false)
 {
 }
 
@@ -1242,6 +1357,21 @@ coord_def travel_pathfind::pathfind(run_mode_type rmode, bool fallback_explore)
                                  !actor_slime_wall_immune(&you));
     unwind_slime_wall_precomputer slime_neighbours(g_Slime_Wall_Check);
 
+    record_steps = reuse_steps && runmode == RMODE_TRAVEL && !floodout
+                   && !try_fallback && !ignore_danger && !features
+                   && !annotate_map;
+    if (record_steps)
+    {
+        const coord_def step = _recorded_travel_step(start, dest);
+        if (!step.origin())
+        {
+            if (_is_safe_move(step))
+                next_travel_move = step;
+            return travel_move();
+        }
+        _start_travel_record(start);
+    }
+
     // How many points are we currently considering? We start off with just one
     // point, and spread outwards like a flood-filler.
     points = 1;
@@ -1297,6 +1427,21 @@ coord_def travel_pathfind::pathfind(run_mode_type rmode, bool fallback_explore)
         if (next_iter_points == 0 && found_target)
             return explore_target();
 
+        // Without greed or wall bias, an explore target's distance is just
+        // the distance travelled, so nothing found in a later round could
+        // beat the one we have; don't flood the rest of the level.
+        if (floodout
+            && (runmode == RMODE_EXPLORE || runmode == RMODE_EXPLORE_GREEDY)
+            && !need_for_greed
+            && !Options.explore_wall_bias
+            && !ignore_hostile
+            && !features
+            && !annotate_map
+            && unexplored_dist != UNFOUND_DIST)
+        {
+            return explore_target();
+        }
+
         // If there are no more points to look at, we're done, but we did
         // not find a path to our target.
         if (next_iter_points == 0)
@@ -1551,7 +1696,11 @@ bool travel_pathfind::path_flood(const coord_def &c, const coord_def &dc)
     {
         return false;
     }
-    else if (dc == dest)
+
+    if (record_steps)
+        _note_travel_touch(c, dc);
+
+    if (dc == dest)
     {
         // Hallelujah, we're home!
         if (_is_safe_move(c))
@@ -1738,7 +1887,10 @@ void find_travel_pos(const coord_def& youpos,
     travel_pathfind tp;
 
     if (need_move)
+    {
         tp.set_src_dst(youpos, you.running.pos);
+        tp.set_reuse_steps();
+    }
     else
         tp.set_floodseed(youpos);
 
@@ -4017,6 +4169,9 @@ bool TravelCache::is_known_branch(uint8_t branch) const
             { return entry.second.is_known_branch(branch); });
 }
 
+// Writes the list of known levels and the waypoints; each level's own
+// information is written separately by save_level(), so that levels which
+// haven't changed needn't be saved again.
 void TravelCache::save(writer& outf) const
 {
     // Travel cache version information
@@ -4027,16 +4182,25 @@ void TravelCache::save(writer& outf) const
     marshallShort(outf, levels.size());
 
     for (const auto &entry : levels)
-    {
         entry.first.save(outf);
-        entry.second.save(outf);
-    }
 
     for (int wp = 0; wp < TRAVEL_WAYPOINT_COUNT; ++wp)
         waypoints[wp].save(outf);
 }
 
-void TravelCache::load(reader& inf, int minorVersion)
+void TravelCache::save_level(writer& outf, const level_id &lev) const
+{
+    levels.at(lev).save(outf);
+}
+
+/**
+ * Read the list of known levels and the waypoints.
+ *
+ * @return the levels whose information must then be read with load_level(),
+ *         after which fixup_levels() should be called. Older saves keep
+ *         the levels inline, and load them here.
+ */
+vector<level_id> TravelCache::load(reader& inf, int minorVersion)
 {
     levels.clear();
 
@@ -4044,27 +4208,41 @@ void TravelCache::load(reader& inf, int minorVersion)
     int major = unmarshallUByte(inf),
         minor = unmarshallUByte(inf);
     if (major != TAG_MAJOR_VERSION || minor > TAG_MINOR_VERSION)
-        return;
+        return {};
 
+    vector<level_id> to_load;
     int level_count = unmarshallShort(inf);
     for (int i = 0; i < level_count; ++i)
     {
         level_id id;
         id.load(inf);
 
-        LevelInfo linfo;
-        // Must set id before load, or travel_hell_entry will not be
-        // correctly set.
-        linfo.id = id;
-        linfo.load(inf, minorVersion);
-
-        levels[id] = linfo;
+#if TAG_MAJOR_VERSION == 34
+        if (minor < TAG_MINOR_LEVEL_CHUNKS)
+        {
+            load_level(inf, id, minorVersion);
+            continue;
+        }
+#endif
+        to_load.push_back(id);
     }
 
     for (int wp = 0; wp < TRAVEL_WAYPOINT_COUNT; ++wp)
         waypoints[wp].load(inf);
 
-    fixup_levels();
+    return to_load;
+}
+
+void TravelCache::load_level(reader& inf, const level_id &lev,
+                             int minorVersion)
+{
+    LevelInfo linfo;
+    // Must set id before load, or travel_hell_entry will not be
+    // correctly set.
+    linfo.id = lev;
+    linfo.load(inf, minorVersion);
+
+    levels[lev] = linfo;
 }
 
 void TravelCache::set_level_excludes()
@@ -459,7 +459,10 @@ public:
     void update_transporter(const coord_def &c);
 
     void save(writer&) const;
-    void load(reader&, int minorVersion);
+    void save_level(writer&, const level_id &lev) const;
+    vector<level_id> load(reader&, int minorVersion);
+    void load_level(reader&, const level_id &lev, int minorVersion);
+    void fixup_levels();
 
     bool is_known_branch(uint8_t branch) const;
 
@@ -470,7 +473,6 @@ public:
 
 private:
     void update_stone_stair(const coord_def &c);
-    void fixup_levels();
 
 private:
     typedef map<level_id, LevelInfo> travel_levels_map;
@@ -537,6 +539,13 @@ public:
         ignore_danger = true;
     }
 
+    // Allow a travel move to be read off the previous travel flood towards
+    // the same destination, when nothing that flood looked at has changed.
+    inline void set_reuse_steps()
+    {
+        reuse_steps = true;
+    }
+
 protected:
     bool is_greed_inducing_square(const coord_def &c) const;
     bool path_examine_point(const coord_def &c);
@@ -627,6 +636,10 @@ protected:
     // Attempt to path through temporary obstructions (like sealed doors)
     // due to the possibility they are no longer obstructing us
     bool try_fallback;
+
+    // Whether this is a plain travel flood that may reuse, and is recording,
+    // the order in which cells are reached.
+    bool reuse_steps, record_steps;
 };
 
 extern TravelCache travel_cache;
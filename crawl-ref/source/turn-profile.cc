@@ -0,0 +1,163 @@
+/**
+ * @file
+ * @brief Lightweight per-subsystem timers for finding where turns go.
+**/
+
+#include "AppHdr.h"
+
+#include "turn-profile.h"
+
+#ifdef TURN_PROFILER
+
+#include <cstdio>
+
+#include "message.h"
+#include "player.h"
+#include "stringutil.h"
+#include "syscalls.h"
+#ifdef USE_TILE_WEB
+#include "tileweb.h"
+#endif
+
+// How many turns to aggregate over for each report to the webtiles server.
+#define PROFILE_REPORT_TURNS 1000
+
+struct prof_section_data
+{
+    int64_t usecs;
+    int calls;
+};
+
+static const char *prof_section_names[] =
+{
+    "world_reacts", "monsters", "noises", "clouds", "view", "save",
+};
+COMPILE_CHECK(ARRAYSZ(prof_section_names) == NUM_PROF_SECTIONS);
+
+static prof_section_data prof_current[NUM_PROF_SECTIONS];
+static prof_section_data prof_last[NUM_PROF_SECTIONS];
+
+// Totals and worst turns over the current reporting window.
+static int64_t prof_window_total[NUM_PROF_SECTIONS];
+static int64_t prof_window_max[NUM_PROF_SECTIONS];
+static int prof_window_turns = 0;
+
+static FILE *prof_file = nullptr;
+static bool prof_show_overlay = false;
+
+prof_timer::~prof_timer()
+{
+    const auto elapsed = chrono::steady_clock::now() - start;
+    prof_current[section].usecs +=
+        chrono::duration_cast<chrono::microseconds>(elapsed).count();
+    prof_current[section].calls++;
+}
+
+/**
+ * Start writing a per-turn breakdown to the given file, as tab-separated
+ * columns of microseconds and call counts for each section.
+ *
+ * @return whether the file could be opened.
+ */
+bool profile_turns_to(const string &filename)
+{
+    if (prof_file)
+        fclose(prof_file);
+
+    prof_file = fopen_u(filename.c_str(), "w");
+    if (!prof_file)
+        return false;
+
+    fprintf(prof_file, "turn");
+    for (const char *name : prof_section_names)
+        fprintf(prof_file, "\t%s_us\t%s_calls", name, name);
+    fprintf(prof_file, "\n");
+    return true;
+}
+
+void profile_toggle_overlay()
+{
+    prof_show_overlay = !prof_show_overlay;
+    mprf("Turn profile display %s.", prof_show_overlay ? "on" : "off");
+}
+
+string profile_last_turn_summary()
+{
+    string summary;
+    for (int i = 0; i < NUM_PROF_SECTIONS; ++i)
+    {
+        if (!summary.empty())
+            summary += ", ";
+        summary += make_stringf("%s %.2fms/%d", prof_section_names[i],
+                                prof_last[i].usecs / 1000.0,
+                                prof_last[i].calls);
+    }
+    return summary;
+}
+
+#ifdef USE_TILE_WEB
+static void _send_window_report()
+{
+    string report = make_stringf("%d turns to turn %d:", prof_window_turns,
+                                 you.num_turns);
+    for (int i = 0; i < NUM_PROF_SECTIONS; ++i)
+    {
+        report += make_stringf(" %s avg %.2fms max %.2fms",
+                               prof_section_names[i],
+                               prof_window_total[i] / 1000.0
+                                   / prof_window_turns,
+                               prof_window_max[i] / 1000.0);
+    }
+    tiles.send_profile_report(report);
+}
+#endif
+
+/**
+ * Close off the current turn's profile: log it, fold it into the reporting
+ * window, and start afresh.
+ */
+void profile_end_turn()
+{
+    if (prof_file)
+    {
+        fprintf(prof_file, "%d", you.num_turns);
+        for (const prof_section_data &data : prof_current)
+        {
+            fprintf(prof_file, "\t%" PRId64 "\t%d", data.usecs,
+                    data.calls);
+        }
+        fprintf(prof_file, "\n");
+    }
+
+    for (int i = 0; i < NUM_PROF_SECTIONS; ++i)
+    {
+        prof_window_total[i] += prof_current[i].usecs;
+        prof_window_max[i] = max(prof_window_max[i], prof_current[i].usecs);
+    }
+
+    if (++prof_window_turns >= PROFILE_REPORT_TURNS)
+    {
+#ifdef USE_TILE_WEB
+        _send_window_report();
+#endif
+        if (prof_file)
+            fflush(prof_file);
+        for (int i = 0; i < NUM_PROF_SECTIONS; ++i)
+            prof_window_total[i] = prof_window_max[i] = 0;
+        prof_window_turns = 0;
+    }
+
+    for (int i = 0; i < NUM_PROF_SECTIONS; ++i)
+    {
+        prof_last[i] = prof_current[i];
+        prof_current[i] = { 0, 0 };
+    }
+
+    if (prof_show_overlay)
+    {
+        mprf(MSGCH_DIAGNOSTICS, "Turn %d: %s", you.num_turns,
+             profile_last_turn_summary().c_str());
+    }
+}
+
+#endif // TURN_PROFILER
@@ -0,0 +1,58 @@
+/**
+ * @file
+ * @brief Lightweight per-subsystem timers for finding where turns go.
+**/
+
+#pragma once
+
+#include <chrono>
+
+enum prof_section_type
+{
+    PROF_WORLD_REACTS,
+    PROF_HANDLE_MONSTERS,
+    PROF_NOISES,
+    PROF_CLOUDS,
+    PROF_VIEWWINDOW,
+    PROF_SAVE,
+    NUM_PROF_SECTIONS
+};
+
+#ifdef TURN_PROFILER
+
+/**
+ * Adds the time between its construction and destruction to a section of the
+ * current turn's profile. Nested timers each count their full time, so a
+ * section's figure includes any sections timed within it.
+ */
+class prof_timer
+{
+public:
+    explicit prof_timer(prof_section_type s)
+        : section(s), start(chrono::steady_clock::now())
+    {
+    }
+    ~prof_timer();
+
+private:
+    prof_section_type section;
+    chrono::steady_clock::time_point start;
+};
+
+# define PROF_CONCAT_(a, b) a##b
+# define PROF_CONCAT(a, b) PROF_CONCAT_(a, b)
+# define PROFILE_SECTION(s) \
+    prof_timer PROF_CONCAT(prof_timer_, __LINE__)(s)
+
+bool profile_turns_to(const string &filename);
+void profile_end_turn();
+void profile_toggle_overlay();
+string profile_last_turn_summary();
+
+#else
+
+# define PROFILE_SECTION(s) ((void) 0)
+
+static inline void profile_end_turn() {}
+
+#endif
@@ -16,6 +16,7 @@
 #include "act-iter.h"
 #include "artefact.h"
 #include "attitude-change.h"
+#include "bitary.h"
 #include "cio.h"
 #include "cloud.h"
 #include "clua.h"
@@ -74,6 +75,7 @@
 #include "tiles-build-specific.h"
 #include "traps.h"
 #include "travel.h"
+#include "turn-profile.h"
 #include "unicode.h"
 #include "unwind.h"
 #include "viewchar.h"
@@ -462,25 +464,48 @@ void update_monsters_in_view()
     int num_hostile = 0;
     vector<string> msgs;
     vector<monster*> monsters;
-
-    for (monster_iterator mi; mi; ++mi)
+    FixedBitVector<MAX_MONSTERS> in_view;
+
+    // Only monsters within LOS range can be in view; the monster index
+    // finds those without touching the rest, in the same (mindex) order.
+    // The arena is the exception: the player sees all of it from off the
+    // map, so every monster needs looking at.
+    const bool arena = crawl_state.game_is_arena()
+                       || crawl_state.arena_suspended;
+    for (monster_iterator mi = arena ? monster_iterator()
+                                     : monster_iterator(you.pos(), LOS_RADIUS);
+         mi; ++mi)
     {
-        if (you.see_cell(mi->pos()))
+        if (!you.see_cell(mi->pos()))
+            continue;
+
+        in_view.set(mi->mindex());
+        if (mi->attitude == ATT_HOSTILE)
+            num_hostile++;
+
+        if (mi->visible_to(&you))
         {
-            if (mi->attitude == ATT_HOSTILE)
-                num_hostile++;
+            if (handle_seen_interrupt(*mi, &msgs))
+                monsters.push_back(*mi);
+            seen_monster(*mi);
+        }
+        else
+            mi->flags &= ~MF_WAS_IN_VIEW;
+    }
 
-            if (mi->visible_to(&you))
+    // Monsters out of view only need tidying up once the player is about
+    // to get control back, and then only if there's something to tidy.
+    if (!you.turn_is_over)
+    {
+        for (monster_iterator mi; mi; ++mi)
+        {
+            if (in_view[mi->mindex()]
+                || !(mi->flags & MF_WAS_IN_VIEW)
+                   && mi->seen_context == SC_NONE)
             {
-                if (handle_seen_interrupt(*mi, &msgs))
-                    monsters.push_back(*mi);
-                seen_monster(*mi);
+                continue;
             }
-            else
-                mi->flags &= ~MF_WAS_IN_VIEW;
-        }
-        else if (!you.turn_is_over)
-        {
+
             if (mi->flags & MF_WAS_IN_VIEW)
             {
                 // Reset client id so the player doesn't know (for sure) he
@@ -1336,6 +1361,18 @@ void run_animation(animation_type anim, use_animation_type type, bool cleanup)
     }
 }
 
+/**
+ * Is viewwindow() only updating what the player knows, without drawing it?
+ * That's the case while asleep, and while resting or travelling with a
+ * negative travel_delay.
+ */
+bool view_drawing_suppressed()
+{
+    const bool run_dont_draw = you.running && Options.travel_delay < 0
+                && (!you.running.is_explore() || Options.explore_delay < 0);
+    return run_dont_draw || you.asleep();
+}
+
 static bool _view_is_updating = false;
 
 /**
@@ -1367,6 +1404,7 @@ void viewwindow(bool show_updates, bool tiles_only, animation *a)
 
     {
         unwind_bool updating(_view_is_updating, true);
+        PROFILE_SECTION(PROF_VIEWWINDOW);
 
         // The player could be at (0,0) if we are called during level-gen; this can
         // happen via mpr -> interrupt_activity -> stop_delay -> runrest::stop
@@ -1408,10 +1446,7 @@ void viewwindow(bool show_updates, bool tiles_only, animation *a)
         if (show_updates)
             player_view_update();
 
-        bool run_dont_draw = you.running && Options.travel_delay < 0
-                    && (!you.running.is_explore() || Options.explore_delay < 0);
-
-        if (run_dont_draw || you.asleep())
+        if (view_drawing_suppressed())
         {
             // Reset env.show if we munged it.
             if (_layers != LAYERS_ALL)
@@ -67,6 +67,7 @@ public:
 
 void run_animation(animation_type anim, use_animation_type type,
                    bool cleanup = true);
+bool view_drawing_suppressed();
 void viewwindow(bool show_updates = true, bool tiles_only = false,
                 animation *a = nullptr);
 void draw_cell(screen_cell_t *cell, const coord_def &gc,
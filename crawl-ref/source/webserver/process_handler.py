@@ -912,6 +912,8 @@ class CrawlProcessHandler(CrawlProcessHandlerBase):
                         self.send_to_all("dump", url = url)
                     else:
                         self.exit_dump_url = url
+            elif msgobj["msg"] == "profile":
+                self.logger.info("Turn profile: %s", msgobj["report"])
             elif msgobj["msg"] == "exit_reason":
                 self.exit_reason = msgobj["type"]
                 if "message" in msgobj:
@@ -824,7 +824,7 @@ static void _debug_acquirement_stats(FILE *ostat)
         mpr("Too many items on level.");
         return;
     }
-    mitm[p].base_type = OBJ_UNASSIGNED;
+    init_item(p);
 
     clear_messages();
     mpr("[a] Weapons [b] Armours   [c] Jewellery [d] Books");
@@ -33,6 +33,7 @@
 #include "spl-transloc.h" // wizard_blink
 #include "stairs.h" // down_stairs
 #include "state.h"
+#include "turn-profile.h" // profile_toggle_overlay
 #include "wizard-option-type.h"
 #include "wiz-dgn.h"
 #include "wiz-dump.h"
@@ -127,7 +128,9 @@ static void _do_wizard_command(int wiz_command)
 
     case 'o': wizard_create_spec_object(); break;
     case 'O': debug_test_explore(); break;
-    // case CONTROL('O'): break;
+#ifdef TURN_PROFILER
+    case CONTROL('O'): profile_toggle_overlay(); break;
+#endif
 
     case 'p': wizard_transform(); break;
     case 'P': debug_place_map(true); break;
@@ -490,6 +493,9 @@ int list_wizard_commands(bool do_redraw_screen)
                        "<w>Ctrl-F</w> double scale fsim\n"
                        "<w>Ctrl-I</w> item generation stats\n"
                        "<w>O</w>      measure exploration time\n"
+#ifdef TURN_PROFILER
+                       "<w>Ctrl-O</w> toggle per-turn timing display\n"
+#endif
                        "<w>Ctrl-T</w> dungeon (D)Lua interpreter\n"
                        "<w>Ctrl-U</w> client (C)Lua interpreter\n"
                        "<w>Ctrl-X</w> Xom effect stats\n"
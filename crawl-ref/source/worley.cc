@@ -194,37 +194,81 @@ namespace worley
         return;
     }
 
-    static void AddSamples(int32_t xi, int32_t yi, int32_t zi, int32_t max_order,
-            double at[3], double *F,
-            double (*delta)[3], uint32_t *ID)
+    /* The feature points of one cube. Neighbouring samples, and the
+       several layers of noise sampled at each cell, keep visiting the
+       same cubes, so the last few cubes seen are remembered. The cached
+       points are exactly those AddSamples() would compute, so results
+       don't change. */
+    struct cube_points
     {
-        double dx, dy, dz, fx, fy, fz, d2;
-        int32_t count, i, j, index;
-        uint32_t seed, this_id;
+        int32_t xi, yi, zi;
+        int32_t count;
+        uint32_t id[5];
+        double f[5][3];
+    };
+
+#define CUBE_CACHE_SIZE 256
+    static cube_points cube_cache[CUBE_CACHE_SIZE];
+    static bool cube_cache_used[CUBE_CACHE_SIZE];
 
+    static const cube_points &_cube_points(int32_t xi, int32_t yi, int32_t zi)
+    {
         /* Each cube has a random number seed based on the cube's ID number.
            The seed might be better if it were a nonlinear hash like Perlin uses
            for noise but we do very well with this faster simple one.
            Our LCG uses Knuth-approved constants for maximal periods. */
-        seed=702395077*xi + 915488749*yi + 2120969693*zi;
+        uint32_t seed=702395077*xi + 915488749*yi + 2120969693*zi;
+
+        const uint32_t slot = (seed ^ (seed >> 16)) % CUBE_CACHE_SIZE;
+        cube_points &cube = cube_cache[slot];
+        if (cube_cache_used[slot]
+            && cube.xi == xi && cube.yi == yi && cube.zi == zi)
+        {
+            return cube;
+        }
+        cube_cache_used[slot] = true;
+        cube.xi = xi;
+        cube.yi = yi;
+        cube.zi = zi;
 
         /* How many feature points are in this cube? */
-        count=Poisson_count[(seed>>24)%256]; /* 256 element lookup table. Use MSB */
+        cube.count=Poisson_count[(seed>>24)%256]; /* 256 element lookup table. Use MSB */
 
         seed=1402024253*seed+586950981; /* churn the seed with good Knuth LCG */
 
-        for (j=0; j<count; j++) /* test and insert each point into our solution */
+        for (int32_t j=0; j<cube.count; j++)
         {
-            this_id=seed;
+            cube.id[j]=seed;
             seed=1402024253*seed+586950981; /* churn */
 
             /* compute the 0..1 feature point location's XYZ */
-            fx=(seed+0.5)*(1.0/4294967296.0);
+            cube.f[j][0]=(seed+0.5)*(1.0/4294967296.0);
             seed=1402024253*seed+586950981; /* churn */
-            fy=(seed+0.5)*(1.0/4294967296.0);
+            cube.f[j][1]=(seed+0.5)*(1.0/4294967296.0);
             seed=1402024253*seed+586950981; /* churn */
-            fz=(seed+0.5)*(1.0/4294967296.0);
+            cube.f[j][2]=(seed+0.5)*(1.0/4294967296.0);
             seed=1402024253*seed+586950981; /* churn */
+        }
+        return cube;
+    }
+
+    static void AddSamples(int32_t xi, int32_t yi, int32_t zi, int32_t max_order,
+            double at[3], double *F,
+            double (*delta)[3], uint32_t *ID)
+    {
+        double dx, dy, dz, fx, fy, fz, d2;
+        int32_t count, i, j, index;
+        uint32_t this_id;
+
+        const cube_points &cube = _cube_points(xi, yi, zi);
+        count=cube.count;
+
+        for (j=0; j<count; j++) /* test and insert each point into our solution */
+        {
+            this_id=cube.id[j];
+            fx=cube.f[j][0];
+            fy=cube.f[j][1];
+            fz=cube.f[j][2];
 
             /* delta from feature point to sample location */
             dx=xi+fx-at[0];